@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "ThreadPool.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include <NitroModules/Promise.hpp>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <sodium.h>
+#include <utility>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Take an ArrayBuffer argument across to a worker thread.
+ * JS-owned buffers may only be read on the JS thread and can be detached or
+ * collected once the call returns, so they are copied here; the copy is wiped
+ * on release since async inputs include keys. Native-owned buffers are shared.
+ * @param buffer Argument as received from JS (may be null)
+ * @return Buffer that stays valid and readable on any thread
+ */
+inline std::shared_ptr<ArrayBuffer> retainForAsync(const std::shared_ptr<ArrayBuffer>& buffer) {
+  if (!buffer || buffer->isOwner()) return buffer;
+  size_t size = buffer->size();
+  uint8_t* data = new uint8_t[size > 0 ? size : 1];
+  if (size > 0) std::memcpy(data, buffer->data(), size);
+  return ArrayBuffer::wrap(data, size, [data, size] {
+    sodium_memzero(data, size);
+    delete[] data;
+  });
+}
+
+/**
+ * Run fn() on the shared ThreadPool and settle a Promise with its result.
+ * Exceptions reject the promise with the original error message.
+ * @param priority Scheduling class (High for interactive signing, Low for sync batches)
+ * @param fn Work returning T; must own everything it captures
+ */
+template <typename T, typename Fn>
+std::shared_ptr<Promise<T>> runAsync(TaskPriority priority, Fn&& fn) {
+  auto promise = Promise<T>::create();
+  ThreadPool::shared().submit([promise, fn = std::forward<Fn>(fn)]() mutable {
+    try {
+      promise->resolve(fn());
+    } catch (...) {
+      promise->reject(std::current_exception());
+    }
+  }, priority);
+  return promise;
+}
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Base58.hpp"
+#include <array>
+
+namespace margelo::nitro::concealcrypto {
+
+static constexpr char ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+static constexpr uint64_t ALPHABET_SIZE = sizeof(ALPHABET) - 1;
+
+// Encoded width for a block of 0..8 bytes
+static constexpr size_t ENCODED_BLOCK_SIZES[] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
+
+// Character -> digit, 0xFF for characters outside the alphabet
+static constexpr std::array<uint8_t, 256> DIGITS = [] {
+  std::array<uint8_t, 256> table{};
+  for (auto& digit : table) digit = 0xFF;
+  for (uint8_t i = 0; i < ALPHABET_SIZE; i++) table[static_cast<uint8_t>(ALPHABET[i])] = i;
+  return table;
+}();
+
+// Byte count for an encoded block width, -1 if no block encodes to that width
+static int decodedBlockSize(size_t encodedSize) {
+  for (size_t i = 0; i <= Base58::FULL_BLOCK_SIZE; i++) {
+    if (ENCODED_BLOCK_SIZES[i] == encodedSize) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+static void encodeBlock(const uint8_t* block, size_t size, char* out) {
+  uint64_t num = 0;
+  for (size_t i = 0; i < size; i++) num = (num << 8) | block[i];
+
+  // Fixed width: leading positions stay '1' (digit zero)
+  for (size_t i = ENCODED_BLOCK_SIZES[size]; i > 0 && num > 0; i--) {
+    out[i - 1] = ALPHABET[num % ALPHABET_SIZE];
+    num /= ALPHABET_SIZE;
+  }
+}
+
+static bool decodeBlock(const char* block, size_t size, uint8_t* out) {
+  int resultSize = decodedBlockSize(size);
+  if (resultSize <= 0) return false;
+
+  uint64_t result = 0;
+  uint64_t order = 1;
+  for (size_t i = size; i > 0; i--) {
+    uint8_t digit = DIGITS[static_cast<uint8_t>(block[i - 1])];
+    if (digit == 0xFF) return false;
+
+    uint64_t product;
+    if (__builtin_mul_overflow(order, digit, &product) ||
+        __builtin_add_overflow(result, product, &result)) {
+      return false;
+    }
+    order *= ALPHABET_SIZE; // may wrap after the last digit, never used then
+  }
+
+  if (static_cast<size_t>(resultSize) < Base58::FULL_BLOCK_SIZE &&
+      (result >> (8 * resultSize)) != 0) {
+    return false;
+  }
+
+  for (int i = resultSize; i > 0; i--) {
+    out[i - 1] = static_cast<uint8_t>(result);
+    result >>= 8;
+  }
+  return true;
+}
+
+std::string Base58::encode(const uint8_t* data, size_t length) {
+  size_t fullBlocks = length / FULL_BLOCK_SIZE;
+  size_t lastBlockSize = length % FULL_BLOCK_SIZE;
+  std::string result(fullBlocks * FULL_ENCODED_BLOCK_SIZE + ENCODED_BLOCK_SIZES[lastBlockSize], ALPHABET[0]);
+
+  for (size_t i = 0; i < fullBlocks; i++) {
+    encodeBlock(data + i * FULL_BLOCK_SIZE, FULL_BLOCK_SIZE, &result[i * FULL_ENCODED_BLOCK_SIZE]);
+  }
+  if (lastBlockSize > 0) {
+    encodeBlock(data + fullBlocks * FULL_BLOCK_SIZE, lastBlockSize, &result[fullBlocks * FULL_ENCODED_BLOCK_SIZE]);
+  }
+  return result;
+}
+
+bool Base58::decode(const std::string& in, std::vector<uint8_t>& out) {
+  size_t fullBlocks = in.size() / FULL_ENCODED_BLOCK_SIZE;
+  size_t lastBlockSize = in.size() % FULL_ENCODED_BLOCK_SIZE;
+  int lastDecodedSize = decodedBlockSize(lastBlockSize);
+  if (lastDecodedSize < 0) return false;
+
+  out.resize(fullBlocks * FULL_BLOCK_SIZE + static_cast<size_t>(lastDecodedSize));
+  for (size_t i = 0; i < fullBlocks; i++) {
+    if (!decodeBlock(in.data() + i * FULL_ENCODED_BLOCK_SIZE, FULL_ENCODED_BLOCK_SIZE, out.data() + i * FULL_BLOCK_SIZE)) {
+      return false;
+    }
+  }
+  if (lastBlockSize > 0 &&
+      !decodeBlock(in.data() + fullBlocks * FULL_ENCODED_BLOCK_SIZE, lastBlockSize, out.data() + fullBlocks * FULL_BLOCK_SIZE)) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Cryptonote block Base58
+ * Input is split into 8-byte blocks, each encoded big-endian into exactly
+ * 11 characters (shorter final blocks use a fixed smaller width), so no
+ * bignum arithmetic is needed.
+ */
+class Base58 {
+public:
+  static constexpr size_t FULL_BLOCK_SIZE = 8;
+  static constexpr size_t FULL_ENCODED_BLOCK_SIZE = 11;
+
+  /**
+   * Encode bytes
+   * @param data Input bytes
+   * @param length Number of input bytes
+   * @return Base58 string
+   */
+  static std::string encode(const uint8_t* data, size_t length);
+
+  /**
+   * Decode a Base58 string
+   * @param in Base58 string
+   * @param out Decoded bytes (replaced)
+   * @return false on invalid characters, invalid final block width or block overflow
+   */
+  static bool decode(const std::string& in, std::vector<uint8_t>& out);
+};
+
+} // namespace margelo::nitro::concealcrypto
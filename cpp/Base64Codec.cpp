@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Base64Codec.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BASE64_CODEC_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define BASE64_CODEC_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * One base64 alphabet and the lookup tables derived from it
+ * The SIMD decoders validate a char c by checking that
+ * checkLo[c & 15] & checkHi[c >> 4] is zero, then map it to its 6-bit value
+ * as c + roll[c >> 4]; the one char whose offset differs from the rest of its
+ * row (`special`) is redirected to an unused roll slot by adding specialShift.
+ */
+struct Base64Alphabet {
+  char chars[64]{};
+  std::array<uint8_t, 256> values{};  // 0-63, 0xFF for anything else
+  std::array<uint8_t, 16> encodeShift{};
+  std::array<uint8_t, 16> checkLo{};
+  std::array<uint8_t, 16> checkHi{};
+  std::array<uint8_t, 16> roll{};
+  char special = 0;
+  uint8_t specialShift = 0;
+};
+
+static constexpr Base64Alphabet makeAlphabet(const char (&chars)[65], char special) {
+  Base64Alphabet a;
+  for (auto& value : a.values) value = 0xFF;
+  for (int i = 0; i < 64; i++) {
+    a.chars[i] = chars[i];
+    a.values[static_cast<uint8_t>(chars[i])] = static_cast<uint8_t>(i);
+  }
+
+  // Index -> char offsets for the encoders: A-Z, a-z and 0-9 are shared by
+  // every variant, slots 11 and 12 hold the two variant-specific chars
+  a.encodeShift[0] = static_cast<uint8_t>('a' - 26);
+  for (int i = 1; i <= 10; i++) a.encodeShift[i] = static_cast<uint8_t>('0' - 52);
+  a.encodeShift[11] = static_cast<uint8_t>(chars[62] - 62);
+  a.encodeShift[12] = static_cast<uint8_t>(chars[63] - 63);
+  a.encodeShift[13] = static_cast<uint8_t>('A');
+
+  // Rows (high nibbles) with the same set of valid low nibbles share one check bit
+  uint16_t rowValid[16]{};
+  for (int c = 0; c < 256; c++) {
+    if (a.values[c] != 0xFF) rowValid[c >> 4] |= static_cast<uint16_t>(1u << (c & 15));
+  }
+  uint16_t classValid[8]{};
+  int classCount = 0;
+  for (int h = 0; h < 16; h++) {
+    int k = 0;
+    while (k < classCount && classValid[k] != rowValid[h]) k++;
+    if (k == classCount) {
+      if (classCount == 8) throw "base64 alphabet needs more than 8 check classes";
+      classValid[classCount++] = rowValid[h];
+    }
+    a.checkHi[h] = static_cast<uint8_t>(1u << k);
+  }
+  for (int k = 0; k < classCount; k++) {
+    for (int l = 0; l < 16; l++) {
+      if (!(classValid[k] & (1u << l))) a.checkLo[l] |= static_cast<uint8_t>(1u << k);
+    }
+  }
+
+  int slot = 0;
+  while (rowValid[slot] != 0) slot++;
+  a.special = special;
+  a.specialShift = static_cast<uint8_t>(slot - (static_cast<uint8_t>(special) >> 4));
+  bool rollSet[16]{};
+  for (int c = 0; c < 128; c++) {
+    if (a.values[c] == 0xFF || c == static_cast<uint8_t>(special)) continue;
+    uint8_t offset = static_cast<uint8_t>(a.values[c] - c);
+    if (rollSet[c >> 4] && a.roll[c >> 4] != offset) throw "base64 alphabet row needs more than one offset";
+    a.roll[c >> 4] = offset;
+    rollSet[c >> 4] = true;
+  }
+  a.roll[slot] = static_cast<uint8_t>(a.values[static_cast<uint8_t>(special)] - static_cast<uint8_t>(special));
+  return a;
+}
+
+static constexpr Base64Alphabet STANDARD =
+  makeAlphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", '/');
+static constexpr Base64Alphabet URL_SAFE =
+  makeAlphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_", '_');
+
+static const Base64Alphabet& alphabetFor(Base64Codec::Variant variant) noexcept {
+  return variant == Base64Codec::Variant::UrlSafe || variant == Base64Codec::Variant::UrlSafeNoPadding
+    ? URL_SAFE : STANDARD;
+}
+
+static bool hasPadding(Base64Codec::Variant variant) noexcept {
+  return variant == Base64Codec::Variant::Original || variant == Base64Codec::Variant::UrlSafe;
+}
+
+// ---------------------------------------------------------------------------
+// Scalar
+// ---------------------------------------------------------------------------
+
+static void encodeScalar(const uint8_t* in, size_t length, char* out, const Base64Alphabet& a, bool pad) noexcept {
+  size_t i = 0;
+  for (; i + 3 <= length; i += 3) {
+    uint32_t v = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8) | in[i + 2];
+    *out++ = a.chars[v >> 18];
+    *out++ = a.chars[(v >> 12) & 0x3F];
+    *out++ = a.chars[(v >> 6) & 0x3F];
+    *out++ = a.chars[v & 0x3F];
+  }
+  if (length - i == 1) {
+    uint32_t v = uint32_t{in[i]} << 16;
+    *out++ = a.chars[v >> 18];
+    *out++ = a.chars[(v >> 12) & 0x3F];
+    if (pad) {
+      *out++ = '=';
+      *out++ = '=';
+    }
+  } else if (length - i == 2) {
+    uint32_t v = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8);
+    *out++ = a.chars[v >> 18];
+    *out++ = a.chars[(v >> 12) & 0x3F];
+    *out++ = a.chars[(v >> 6) & 0x3F];
+    if (pad) *out++ = '=';
+  }
+}
+
+// `length` counts data chars only (padding already stripped)
+static bool decodeScalar(const char* in, size_t length, uint8_t* out, const Base64Alphabet& a) noexcept {
+  auto value = [&a](char c) { return a.values[static_cast<uint8_t>(c)]; };
+  size_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    uint32_t v0 = value(in[i]), v1 = value(in[i + 1]), v2 = value(in[i + 2]), v3 = value(in[i + 3]);
+    if ((v0 | v1 | v2 | v3) > 0x3F) return false;
+    uint32_t v = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+    *out++ = static_cast<uint8_t>(v >> 16);
+    *out++ = static_cast<uint8_t>(v >> 8);
+    *out++ = static_cast<uint8_t>(v);
+  }
+  switch (length - i) {
+    case 0:
+      return true;
+    case 2: {
+      uint32_t v0 = value(in[i]), v1 = value(in[i + 1]);
+      if ((v0 | v1) > 0x3F || (v1 & 0x0F) != 0) return false;
+      *out = static_cast<uint8_t>((v0 << 2) | (v1 >> 4));
+      return true;
+    }
+    case 3: {
+      uint32_t v0 = value(in[i]), v1 = value(in[i + 1]), v2 = value(in[i + 2]);
+      if ((v0 | v1 | v2) > 0x3F || (v2 & 0x03) != 0) return false;
+      uint32_t v = (v0 << 18) | (v1 << 12) | (v2 << 6);
+      out[0] = static_cast<uint8_t>(v >> 16);
+      out[1] = static_cast<uint8_t>(v >> 8);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+#if defined(BASE64_CODEC_X86)
+
+// ---------------------------------------------------------------------------
+// SSSE3: 12 bytes <-> 16 chars per iteration
+// ---------------------------------------------------------------------------
+
+// Spread 12 bytes (of a 16-byte load) into 16 6-bit indices, one per byte
+__attribute__((target("ssse3")))
+static inline __m128i splitSsse3(__m128i in) noexcept {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+  const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t0, t1);
+}
+
+// Map 6-bit indices to chars: pick a per-range offset, then add it
+__attribute__((target("ssse3")))
+static inline __m128i charsSsse3(__m128i indices, __m128i shift) noexcept {
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+  return _mm_add_epi8(_mm_shuffle_epi8(shift, range), indices);
+}
+
+__attribute__((target("ssse3")))
+static void encodeSsse3(const uint8_t* in, size_t length, char* out, const Base64Alphabet& a, bool pad) noexcept {
+  const __m128i shift = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.encodeShift.data()));
+  size_t i = 0;
+  for (; i + 16 <= length; i += 12) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 3 * 4), charsSsse3(splitSsse3(bytes), shift));
+  }
+  encodeScalar(in + i, length - i, out + i / 3 * 4, a, pad);
+}
+
+// Map 16 chars to 6-bit values; false if any char is outside the alphabet
+__attribute__((target("ssse3")))
+static inline bool valuesSsse3(__m128i c, const Base64Alphabet& a, __m128i& values) noexcept {
+  const __m128i hi = _mm_and_si128(_mm_srli_epi32(c, 4), _mm_set1_epi8(0x0F));
+  const __m128i lo = _mm_and_si128(c, _mm_set1_epi8(0x0F));
+  const __m128i checkLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.checkLo.data()));
+  const __m128i checkHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.checkHi.data()));
+  const __m128i check = _mm_and_si128(_mm_shuffle_epi8(checkLo, lo), _mm_shuffle_epi8(checkHi, hi));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(check, _mm_setzero_si128())) != 0xFFFF) return false;
+  const __m128i roll = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.roll.data()));
+  const __m128i special = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(a.special)),
+                                        _mm_set1_epi8(static_cast<char>(a.specialShift)));
+  values = _mm_add_epi8(c, _mm_shuffle_epi8(roll, _mm_add_epi8(hi, special)));
+  return true;
+}
+
+// Join 16 6-bit values into 12 bytes at the bottom of the register
+__attribute__((target("ssse3")))
+static inline __m128i packSsse3(__m128i values) noexcept {
+  const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(words, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+__attribute__((target("ssse3")))
+static bool decodeSsse3(const char* in, size_t length, uint8_t* out, const Base64Alphabet& a) noexcept {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i values;
+    if (!valuesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), a, values)) return false;
+    const __m128i bytes = packSsse3(values);
+    // Store exactly 12 bytes: the result buffer has no slack
+    uint8_t* dst = out + i / 4 * 3;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), bytes);
+    uint32_t tail = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(bytes, 8)));
+    std::memcpy(dst + 8, &tail, sizeof(tail));
+  }
+  return decodeScalar(in + i, length - i, out + i / 4 * 3, a);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: 24 bytes <-> 32 chars per iteration (the SSSE3 steps on both lanes)
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2")))
+static void encodeAvx2(const uint8_t* in, size_t length, char* out, const Base64Alphabet& a, bool pad) noexcept {
+  const __m256i shift = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.encodeShift.data())));
+  const __m256i spread = _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  size_t i = 0;
+  for (; i + 28 <= length; i += 24) {
+    // Lane 0 takes bytes [i, i + 12), lane 1 bytes [i + 12, i + 24)
+    __m256i bytes = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))),
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12)), 1);
+    bytes = _mm256_shuffle_epi8(bytes, spread);
+    const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t0, t1);
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+    const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift, range), indices);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 3 * 4), chars);
+  }
+  encodeSsse3(in + i, length - i, out + i / 3 * 4, a, pad);
+}
+
+__attribute__((target("avx2")))
+static bool decodeAvx2(const char* in, size_t length, uint8_t* out, const Base64Alphabet& a) noexcept {
+  const __m256i checkLo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.checkLo.data())));
+  const __m256i checkHi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.checkHi.data())));
+  const __m256i roll = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.roll.data())));
+  const __m256i special = _mm256_set1_epi8(a.special);
+  const __m256i specialShift = _mm256_set1_epi8(static_cast<char>(a.specialShift));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  const __m256i gather = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi32(c, 4), nibble);
+    const __m256i lo = _mm256_and_si256(c, nibble);
+    const __m256i check = _mm256_and_si256(_mm256_shuffle_epi8(checkLo, lo), _mm256_shuffle_epi8(checkHi, hi));
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(check, _mm256_setzero_si256())) != -1) return false;
+    const __m256i index = _mm256_add_epi8(hi, _mm256_and_si256(_mm256_cmpeq_epi8(c, special), specialShift));
+    const __m256i values = _mm256_add_epi8(c, _mm256_shuffle_epi8(roll, index));
+    const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    // 12 bytes at the bottom of each lane: close the gap between the lanes
+    const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(words, gather),
+                                                      _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    uint8_t* dst = out + i / 4 * 3;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(bytes));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16), _mm256_extracti128_si256(bytes, 1));
+  }
+  return decodeSsse3(in + i, length - i, out + i / 4 * 3, a);
+}
+
+using EncodeFn = void (*)(const uint8_t*, size_t, char*, const Base64Alphabet&, bool) noexcept;
+using DecodeFn = bool (*)(const char*, size_t, uint8_t*, const Base64Alphabet&) noexcept;
+
+static EncodeFn selectEncode() noexcept {
+  if (__builtin_cpu_supports("avx2")) return &encodeAvx2;
+  if (__builtin_cpu_supports("ssse3")) return &encodeSsse3;
+  return &encodeScalar;
+}
+
+static DecodeFn selectDecode() noexcept {
+  if (__builtin_cpu_supports("avx2")) return &decodeAvx2;
+  if (__builtin_cpu_supports("ssse3")) return &decodeSsse3;
+  return &decodeScalar;
+}
+
+#elif defined(BASE64_CODEC_NEON)
+
+// ---------------------------------------------------------------------------
+// NEON: 48 bytes <-> 64 chars per iteration (vld3/vst4 and vld4/vst3 do the
+// interleaving, 64-entry table lookups map indices and chars directly)
+// ---------------------------------------------------------------------------
+
+static inline uint8x16x4_t loadTable(const uint8_t* table) noexcept {
+  uint8x16x4_t t;
+  t.val[0] = vld1q_u8(table);
+  t.val[1] = vld1q_u8(table + 16);
+  t.val[2] = vld1q_u8(table + 32);
+  t.val[3] = vld1q_u8(table + 48);
+  return t;
+}
+
+static void encodeNeon(const uint8_t* in, size_t length, char* out, const Base64Alphabet& a, bool pad) noexcept {
+  const uint8x16x4_t table = loadTable(reinterpret_cast<const uint8_t*>(a.chars));
+  const uint8x16_t mask = vdupq_n_u8(0x3F);
+  size_t i = 0;
+  for (; i + 48 <= length; i += 48) {
+    uint8x16x3_t bytes = vld3q_u8(in + i);
+    uint8x16x4_t chars;
+    chars.val[0] = vqtbl4q_u8(table, vshrq_n_u8(bytes.val[0], 2));
+    chars.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask));
+    chars.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask));
+    chars.val[3] = vqtbl4q_u8(table, vandq_u8(bytes.val[2], mask));
+    vst4q_u8(reinterpret_cast<uint8_t*>(out + i / 3 * 4), chars);
+  }
+  encodeScalar(in + i, length - i, out + i / 3 * 4, a, pad);
+}
+
+static bool decodeNeon(const char* in, size_t length, uint8_t* out, const Base64Alphabet& a) noexcept {
+  // values[0, 64) and values[64, 128); chars >= 128 are caught by their top bit
+  const uint8x16x4_t low = loadTable(a.values.data());
+  const uint8x16x4_t high = loadTable(a.values.data() + 64);
+  const uint8x16_t offset = vdupq_n_u8(64);
+  const uint8x16_t topBit = vdupq_n_u8(0x80);
+  size_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    uint8x16x4_t c = vld4q_u8(reinterpret_cast<const uint8_t*>(in + i));
+    uint8x16_t v0 = vqtbx4q_u8(vqtbl4q_u8(low, c.val[0]), high, vsubq_u8(c.val[0], offset));
+    uint8x16_t v1 = vqtbx4q_u8(vqtbl4q_u8(low, c.val[1]), high, vsubq_u8(c.val[1], offset));
+    uint8x16_t v2 = vqtbx4q_u8(vqtbl4q_u8(low, c.val[2]), high, vsubq_u8(c.val[2], offset));
+    uint8x16_t v3 = vqtbx4q_u8(vqtbl4q_u8(low, c.val[3]), high, vsubq_u8(c.val[3], offset));
+    uint8x16_t any = vorrq_u8(vorrq_u8(v0, v1), vorrq_u8(v2, v3));
+    uint8x16_t anyChar = vorrq_u8(vorrq_u8(c.val[0], c.val[1]), vorrq_u8(c.val[2], c.val[3]));
+    if (vmaxvq_u8(vorrq_u8(any, vandq_u8(anyChar, topBit))) > 0x3F) return false;
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(v0, 2), vshrq_n_u8(v1, 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(v1, 4), vshrq_n_u8(v2, 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(v2, 6), v3);
+    vst3q_u8(out + i / 4 * 3, bytes);
+  }
+  return decodeScalar(in + i, length - i, out + i / 4 * 3, a);
+}
+
+#endif
+
+Base64Codec::Variant Base64Codec::parseVariant(const std::string& name) {
+  if (name == "original") return Variant::Original;
+  if (name == "original-no-padding") return Variant::OriginalNoPadding;
+  if (name == "urlsafe") return Variant::UrlSafe;
+  if (name == "urlsafe-no-padding") return Variant::UrlSafeNoPadding;
+  throw std::invalid_argument("Unsupported base64 variant: " + name +
+                              " (expected original, original-no-padding, urlsafe or urlsafe-no-padding)");
+}
+
+size_t Base64Codec::encodedLength(size_t length, Variant variant) noexcept {
+  if (hasPadding(variant)) return (length + 2) / 3 * 4;
+  return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+}
+
+void Base64Codec::encode(const uint8_t* in, size_t length, char* out, Variant variant) noexcept {
+  const Base64Alphabet& alphabet = alphabetFor(variant);
+#if defined(BASE64_CODEC_X86)
+  static const EncodeFn impl = selectEncode();
+  impl(in, length, out, alphabet, hasPadding(variant));
+#elif defined(BASE64_CODEC_NEON)
+  encodeNeon(in, length, out, alphabet, hasPadding(variant));
+#else
+  encodeScalar(in, length, out, alphabet, hasPadding(variant));
+#endif
+}
+
+std::string Base64Codec::encode(const uint8_t* in, size_t length, Variant variant) {
+  std::string result(encodedLength(length, variant), '\0');
+  encode(in, length, result.data(), variant);
+  return result;
+}
+
+bool Base64Codec::decodedLength(const char* in, size_t length, Variant variant, size_t& decodedLength) noexcept {
+  size_t chars = length;
+  if (hasPadding(variant)) {
+    if (length % 4 != 0) return false;
+    while (chars > 0 && length - chars < 2 && in[chars - 1] == '=') chars--;
+  }
+  if (chars % 4 == 1) return false;
+  decodedLength = chars / 4 * 3 + (chars % 4 == 0 ? 0 : chars % 4 - 1);
+  return true;
+}
+
+bool Base64Codec::decode(const char* in, size_t length, uint8_t* out, Variant variant) noexcept {
+  size_t bytes;
+  if (!decodedLength(in, length, variant, bytes)) return false;
+  size_t chars = bytes / 3 * 4 + (bytes % 3 == 0 ? 0 : bytes % 3 + 1);
+  const Base64Alphabet& alphabet = alphabetFor(variant);
+#if defined(BASE64_CODEC_X86)
+  static const DecodeFn impl = selectDecode();
+  return impl(in, chars, out, alphabet);
+#elif defined(BASE64_CODEC_NEON)
+  return decodeNeon(in, chars, out, alphabet);
+#else
+  return decodeScalar(in, chars, out, alphabet);
+#endif
+}
+
+} // namespace margelo::nitro::concealcrypto
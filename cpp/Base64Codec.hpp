@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Base64 codec (RFC 4648) shared by every base64 conversion in the module
+ * Same variants and strictness as libsodium's sodium_bin2base64 / sodium_base642bin
+ * (padding required or rejected per variant, non-zero trailing bits rejected).
+ * Vectorized with AVX2 / SSSE3 (selected at runtime) on x86 and NEON on arm64,
+ * with a table-driven scalar fallback for tails and other targets.
+ */
+class Base64Codec {
+public:
+  enum class Variant : uint8_t {
+    Original,           // "+/" with "=" padding (nacl.util.encodeBase64)
+    OriginalNoPadding,  // "+/" without padding
+    UrlSafe,            // "-_" with "=" padding
+    UrlSafeNoPadding,   // "-_" without padding
+  };
+
+  /**
+   * @param name "original", "original-no-padding", "urlsafe" or "urlsafe-no-padding"
+   * @throws std::invalid_argument for any other name
+   */
+  static Variant parseVariant(const std::string& name);
+
+  /**
+   * Number of chars encode() writes for length input bytes
+   */
+  static size_t encodedLength(size_t length, Variant variant) noexcept;
+
+  /**
+   * Encode bytes as base64
+   * @param in Input bytes
+   * @param length Number of input bytes
+   * @param out Output buffer of encodedLength(length) chars (not NUL-terminated)
+   */
+  static void encode(const uint8_t* in, size_t length, char* out, Variant variant) noexcept;
+
+  /**
+   * Encode bytes as a base64 string
+   */
+  static std::string encode(const uint8_t* in, size_t length, Variant variant);
+
+  /**
+   * Exact decoded size of a base64 string, from its length and padding only
+   * @param decodedLength Set to the number of bytes decode() writes
+   * @return false if the length or padding is impossible for the variant
+   */
+  static bool decodedLength(const char* in, size_t length, Variant variant, size_t& decodedLength) noexcept;
+
+  /**
+   * Decode base64 into bytes
+   * @param in Base64 characters
+   * @param length Number of characters, including padding
+   * @param out Output buffer of decodedLength() bytes
+   * @return false on bad length or padding, any character outside the
+   *         variant's alphabet, or non-zero trailing bits
+   */
+  static bool decode(const char* in, size_t length, uint8_t* out, Variant variant) noexcept;
+};
+
+} // namespace margelo::nitro::concealcrypto
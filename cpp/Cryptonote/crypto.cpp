@@ -18,6 +18,7 @@
 #include "CryptoTypes.h"
 #include "generic-ops.h"
 #include "random.h"
+#include "mn_random.h"
 extern "C" {
 #include "hash-ops.h"
 #include "crypto-ops.h"
@@ -33,10 +34,6 @@ namespace crypto {
   extern "C" {
 #include "crypto-ops.h"
   }
-  // Use libsodium for random bytes (already linked via CMake)
-  extern "C" {
-    void randombytes_buf(void* const buf, const size_t size);
-  }
 
   static inline unsigned char *operator &(EllipticCurvePoint &point) {
     return &reinterpret_cast<unsigned char &>(point);
@@ -59,7 +56,7 @@ namespace crypto {
 
   static inline void random_scalar(EllipticCurveScalar &res) {
     unsigned char tmp[64];
-    randombytes_buf(tmp, 64);  // Use libsodium (already linked, no extra deps)
+    mn_random_fill(tmp, 64);  // Per-thread buffered CSPRNG (mn_random.cpp)
     sc_reduce(tmp);
     memcpy(&res, tmp, 32);
   }
@@ -558,7 +555,6 @@ void crypto_ops::generate_tx_proof(const Hash &prefix_hash, const PublicKey &R,
     const PublicKey *const *pubs, size_t pubs_count,
     const SecretKey &sec, size_t sec_index,
     Signature *sig) {
-    lock_guard<mutex> lock(random_lock);
     size_t i;
     ge_p3 image_unp;
     ge_dsmp image_pre;
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "HexCodec.hpp"
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HEX_CODEC_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define HEX_CODEC_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace margelo::nitro::concealcrypto {
+
+static constexpr char HEX_CHARS[] = "0123456789abcdef";
+
+// 0x00-0x0F for hex digits, 0xFF for anything else
+static constexpr std::array<uint8_t, 256> HEX_VALUES = [] {
+  std::array<uint8_t, 256> table{};
+  for (auto& value : table) value = 0xFF;
+  for (int c = '0'; c <= '9'; c++) table[c] = static_cast<uint8_t>(c - '0');
+  for (int c = 'a'; c <= 'f'; c++) table[c] = static_cast<uint8_t>(c - 'a' + 10);
+  for (int c = 'A'; c <= 'F'; c++) table[c] = static_cast<uint8_t>(c - 'A' + 10);
+  return table;
+}();
+
+// ---------------------------------------------------------------------------
+// Scalar
+// ---------------------------------------------------------------------------
+
+static void encodeScalar(const uint8_t* in, size_t length, char* out) noexcept {
+  for (size_t i = 0; i < length; ++i) {
+    out[i * 2] = HEX_CHARS[in[i] >> 4];
+    out[i * 2 + 1] = HEX_CHARS[in[i] & 0x0F];
+  }
+}
+
+static bool decodeScalar(const char* in, size_t length, uint8_t* out) noexcept {
+  for (size_t i = 0; i < length; ++i) {
+    uint8_t h = HEX_VALUES[static_cast<uint8_t>(in[i * 2])];
+    uint8_t l = HEX_VALUES[static_cast<uint8_t>(in[i * 2 + 1])];
+    if ((h | l) == 0xFF || h > 0x0F || l > 0x0F) return false;
+    out[i] = static_cast<uint8_t>((h << 4) | l);
+  }
+  return true;
+}
+
+#if defined(HEX_CODEC_X86)
+
+// ---------------------------------------------------------------------------
+// SSSE3: 16 bytes <-> 32 chars per iteration
+// ---------------------------------------------------------------------------
+
+__attribute__((target("ssse3")))
+static void encodeSsse3(const uint8_t* in, size_t length, char* out) noexcept {
+  const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_CHARS));
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+    __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, nibble));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+  }
+  encodeScalar(in + i, length - i, out + i * 2);
+}
+
+// Map 16 hex chars to nibbles; `valid` gets 0xFF lanes for hex digits
+__attribute__((target("ssse3")))
+static inline __m128i nibblesSsse3(__m128i c, __m128i& valid) noexcept {
+  const __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+  const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+  const __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                        _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+  valid = _mm_or_si128(isDigit, isAlpha);
+  const __m128i digit = _mm_and_si128(_mm_sub_epi8(c, _mm_set1_epi8('0')), isDigit);
+  const __m128i alpha = _mm_and_si128(_mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)), isAlpha);
+  return _mm_or_si128(digit, alpha);
+}
+
+__attribute__((target("ssse3")))
+static bool decodeSsse3(const char* in, size_t length, uint8_t* out) noexcept {
+  // (high nibble * 16 + low nibble) for each char pair
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i valid0, valid1;
+    __m128i n0 = nibblesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2)), valid0);
+    __m128i n1 = nibblesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2 + 16)), valid1);
+    if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF) return false;
+    __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(n0, weights), _mm_maddubs_epi16(n1, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), bytes);
+  }
+  return decodeScalar(in + i * 2, length - i, out + i);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: 32 bytes <-> 64 chars per iteration
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2")))
+static void encodeAvx2(const uint8_t* in, size_t length, char* out) noexcept {
+  const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_CHARS)));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+    __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(bytes, nibble));
+    // unpack works per 128-bit lane: reorder lanes to restore byte order
+    __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+  }
+  encodeSsse3(in + i, length - i, out + i * 2);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i nibblesAvx2(__m256i c, __m256i& valid) noexcept {
+  const __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+  const __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+  const __m256i isAlpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+  valid = _mm256_or_si256(isDigit, isAlpha);
+  const __m256i digit = _mm256_and_si256(_mm256_sub_epi8(c, _mm256_set1_epi8('0')), isDigit);
+  const __m256i alpha = _mm256_and_si256(_mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)), isAlpha);
+  return _mm256_or_si256(digit, alpha);
+}
+
+__attribute__((target("avx2")))
+static bool decodeAvx2(const char* in, size_t length, uint8_t* out) noexcept {
+  const __m256i weights = _mm256_set1_epi16(0x0110);
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    __m256i valid0, valid1;
+    __m256i n0 = nibblesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 2)), valid0);
+    __m256i n1 = nibblesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 2 + 32)), valid1);
+    if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) return false;
+    // packus works per lane: fix the 64-bit quarter order afterwards
+    __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(n0, weights), _mm256_maddubs_epi16(n1, weights));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(packed, 0xD8));
+  }
+  return decodeSsse3(in + i * 2, length - i, out + i);
+}
+
+using EncodeFn = void (*)(const uint8_t*, size_t, char*) noexcept;
+using DecodeFn = bool (*)(const char*, size_t, uint8_t*) noexcept;
+
+static EncodeFn selectEncode() noexcept {
+  if (__builtin_cpu_supports("avx2")) return &encodeAvx2;
+  if (__builtin_cpu_supports("ssse3")) return &encodeSsse3;
+  return &encodeScalar;
+}
+
+static DecodeFn selectDecode() noexcept {
+  if (__builtin_cpu_supports("avx2")) return &decodeAvx2;
+  if (__builtin_cpu_supports("ssse3")) return &decodeSsse3;
+  return &decodeScalar;
+}
+
+#elif defined(HEX_CODEC_NEON)
+
+// ---------------------------------------------------------------------------
+// NEON: 16 bytes <-> 32 chars per iteration (vst2/vld2 do the interleaving)
+// ---------------------------------------------------------------------------
+
+static void encodeNeon(const uint8_t* in, size_t length, char* out) noexcept {
+  const uint8x16_t lut = vld1q_u8(reinterpret_cast<const uint8_t*>(HEX_CHARS));
+  const uint8x16_t nibble = vdupq_n_u8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t bytes = vld1q_u8(in + i);
+    uint8x16x2_t chars;
+    chars.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(bytes, 4));
+    chars.val[1] = vqtbl1q_u8(lut, vandq_u8(bytes, nibble));
+    vst2q_u8(reinterpret_cast<uint8_t*>(out + i * 2), chars);
+  }
+  encodeScalar(in + i, length - i, out + i * 2);
+}
+
+static inline uint8x16_t nibblesNeon(uint8x16_t c, uint8x16_t& valid) noexcept {
+  const uint8x16_t digit = vsubq_u8(c, vdupq_n_u8('0'));
+  const uint8x16_t alpha = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+  const uint8x16_t isAlpha = vcltq_u8(alpha, vdupq_n_u8(6));
+  valid = vorrq_u8(isDigit, isAlpha);
+  return vbslq_u8(isDigit, digit, vaddq_u8(alpha, vdupq_n_u8(10)));
+}
+
+static bool decodeNeon(const char* in, size_t length, uint8_t* out) noexcept {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    uint8x16x2_t chars = vld2q_u8(reinterpret_cast<const uint8_t*>(in + i * 2));
+    uint8x16_t validHi, validLo;
+    uint8x16_t hi = nibblesNeon(chars.val[0], validHi);
+    uint8x16_t lo = nibblesNeon(chars.val[1], validLo);
+    if (vminvq_u8(vandq_u8(validHi, validLo)) != 0xFF) return false;
+    vst1q_u8(out + i, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+  }
+  return decodeScalar(in + i * 2, length - i, out + i);
+}
+
+#endif
+
+void HexCodec::encode(const uint8_t* in, size_t length, char* out) noexcept {
+#if defined(HEX_CODEC_X86)
+  static const EncodeFn impl = selectEncode();
+  impl(in, length, out);
+#elif defined(HEX_CODEC_NEON)
+  encodeNeon(in, length, out);
+#else
+  encodeScalar(in, length, out);
+#endif
+}
+
+std::string HexCodec::encode(const uint8_t* in, size_t length) {
+  std::string result(length * 2, '\0');
+  encode(in, length, result.data());
+  return result;
+}
+
+bool HexCodec::decode(const char* in, size_t hexLength, uint8_t* out) noexcept {
+  if (hexLength % 2 != 0) return false;
+#if defined(HEX_CODEC_X86)
+  static const DecodeFn impl = selectDecode();
+  return impl(in, hexLength / 2, out);
+#elif defined(HEX_CODEC_NEON)
+  return decodeNeon(in, hexLength / 2, out);
+#else
+  return decodeScalar(in, hexLength / 2, out);
+#endif
+}
+
+} // namespace margelo::nitro::concealcrypto
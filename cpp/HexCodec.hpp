@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Hex codec shared by every hex conversion in the module
+ * Vectorized with AVX2 / SSSE3 (selected at runtime) on x86 and NEON on arm64,
+ * with a table-driven scalar fallback for tails and other targets.
+ */
+class HexCodec {
+public:
+  /**
+   * Encode bytes as lowercase hex
+   * @param in Input bytes
+   * @param length Number of input bytes
+   * @param out Output buffer of 2 * length chars (not NUL-terminated)
+   */
+  static void encode(const uint8_t* in, size_t length, char* out) noexcept;
+
+  /**
+   * Encode bytes as a lowercase hex string
+   */
+  static std::string encode(const uint8_t* in, size_t length);
+
+  /**
+   * Decode hex (upper or lower case) into bytes
+   * @param in Hex characters
+   * @param hexLength Number of hex characters (must be even)
+   * @param out Output buffer of hexLength / 2 bytes
+   * @return false on odd length or any non-hex character
+   */
+  static bool decode(const char* in, size_t hexLength, uint8_t* out) noexcept;
+};
+
+} // namespace margelo::nitro::concealcrypto
@@ -7,14 +7,13 @@
  * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
  */
 #include "Hmac.hpp"
+#include "Sha1Accel.hpp"
 #include <cstring>
+#include <sodium.h>
 #include <stdexcept>
 
 namespace margelo::nitro::concealcrypto {
 
-// Initialize thread-local buffers
-thread_local Hmac::HmacBuffers Hmac::buffers;
-
 std::shared_ptr<ArrayBuffer> Hmac::hmacSha1(
     const std::shared_ptr<ArrayBuffer>& key,
     const std::shared_ptr<ArrayBuffer>& data) {
@@ -23,88 +22,163 @@ std::shared_ptr<ArrayBuffer> Hmac::hmacSha1(
     throw std::invalid_argument("Key and data must not be null");
   }
 
-  // Convert ArrayBuffers to vectors for easier manipulation
-  std::vector<uint8_t> keyBytes = arrayBufferToVector(key);
-  std::vector<uint8_t> dataBytes = arrayBufferToVector(data);
+  // Only allocation of the call: the 20-byte result, written in place
+  auto result = ArrayBuffer::allocate(SHA1_DIGEST_SIZE);
+  hmacSha1(static_cast<const uint8_t*>(key->data()), key->size(),
+           static_cast<const uint8_t*>(data->data()), data->size(),
+           static_cast<uint8_t*>(result->data()));
+  return result;
+}
+
+void Hmac::hmacSha1(const uint8_t* key, size_t keyLength,
+                    const uint8_t* data, size_t dataLength,
+                    uint8_t out[SHA1_DIGEST_SIZE]) noexcept {
+  HmacSha1State state;
+  hmacSha1Init(state, key, keyLength);
+  hmacSha1Mac(state, data, dataLength, out);
+  sodium_memzero(&state, sizeof(state));
+}
 
+void Hmac::hmacSha1Init(HmacSha1State& state, const uint8_t* key, size_t keyLength) noexcept {
   // HMAC-SHA1 implementation following RFC 2104
-  constexpr size_t blockSize = 64; // SHA-1 block size
-  
-  // Step 1: Prepare the key
-  if (keyBytes.size() > blockSize) {
-    keyBytes = sha1(keyBytes);
+  uint8_t keyBlock[SHA1_BLOCK_SIZE] = {0};
+  uint8_t pad[SHA1_BLOCK_SIZE];
+
+  // Step 1: Prepare the key (hash if longer than a block, zero-pad otherwise)
+  if (keyLength > SHA1_BLOCK_SIZE) {
+    Sha1Context ctx;
+    sha1Init(ctx);
+    sha1Update(ctx, key, keyLength);
+    sha1Final(ctx, keyBlock);
+    sodium_memzero(&ctx, sizeof(ctx));
+  } else if (keyLength > 0) {
+    std::memcpy(keyBlock, key, keyLength);
   }
-  
-  if (keyBytes.size() < blockSize) {
-    keyBytes.resize(blockSize, 0);
+
+  // Step 2: Absorb (key ^ ipad) and (key ^ opad) once
+  for (size_t i = 0; i < SHA1_BLOCK_SIZE; i++) pad[i] = keyBlock[i] ^ 0x36;
+  sha1Init(state.inner);
+  sha1Update(state.inner, pad, SHA1_BLOCK_SIZE);
+
+  for (size_t i = 0; i < SHA1_BLOCK_SIZE; i++) pad[i] = keyBlock[i] ^ 0x5c;
+  sha1Init(state.outer);
+  sha1Update(state.outer, pad, SHA1_BLOCK_SIZE);
+
+  // sodium_memzero, not memset: these locals are dead after this point
+  sodium_memzero(keyBlock, sizeof(keyBlock));
+  sodium_memzero(pad, sizeof(pad));
+}
+
+void Hmac::hmacSha1Mac(const HmacSha1State& state, const uint8_t* data, size_t dataLength,
+                       uint8_t out[SHA1_DIGEST_SIZE]) noexcept {
+  uint8_t innerHash[SHA1_DIGEST_SIZE];
+
+  // Step 3: Inner hash: SHA1((key ^ ipad) || data)
+  Sha1Context ctx = state.inner;
+  sha1Update(ctx, data, dataLength);
+  sha1Final(ctx, innerHash);
+
+  // Step 4: Outer hash: SHA1((key ^ opad) || innerHash)
+  ctx = state.outer;
+  sha1Update(ctx, innerHash, SHA1_DIGEST_SIZE);
+  sha1Final(ctx, out);
+
+  // The midstate copy is as sensitive as the key
+  sodium_memzero(&ctx, sizeof(ctx));
+  sodium_memzero(innerHash, sizeof(innerHash));
+}
+
+void Hmac::sha1Init(Sha1Context& ctx) noexcept {
+  // Initialize hash values (h0, h1, h2, h3, h4)
+  ctx.h[0] = 0x67452301;
+  ctx.h[1] = 0xEFCDAB89;
+  ctx.h[2] = 0x98BADCFE;
+  ctx.h[3] = 0x10325476;
+  ctx.h[4] = 0xC3D2E1F0;
+  ctx.length = 0;
+  ctx.blockLength = 0;
+}
+
+void Hmac::sha1Update(Sha1Context& ctx, const uint8_t* data, size_t length) noexcept {
+  if (length == 0) return;
+  ctx.length += length;
+
+  // Complete a pending partial block first
+  if (ctx.blockLength > 0) {
+    size_t take = SHA1_BLOCK_SIZE - ctx.blockLength;
+    if (take > length) take = length;
+    std::memcpy(ctx.block + ctx.blockLength, data, take);
+    ctx.blockLength += take;
+    data += take;
+    length -= take;
+    if (ctx.blockLength < SHA1_BLOCK_SIZE) return;
+    sha1Compress(ctx.h, ctx.block, 1);
+    ctx.blockLength = 0;
   }
-  
-  // Step 2: Create inner and outer padded keys (reuse thread-local buffers for performance)
-  buffers.innerPadded.resize(blockSize);
-  buffers.outerPadded.resize(blockSize);
-  
-  for (size_t i = 0; i < blockSize; i++) {
-    buffers.innerPadded[i] = keyBytes[i] ^ 0x36;
-    buffers.outerPadded[i] = keyBytes[i] ^ 0x5c;
+
+  // Compress full blocks straight from the input
+  size_t blocks = length / SHA1_BLOCK_SIZE;
+  if (blocks > 0) {
+    sha1Compress(ctx.h, data, blocks);
+    data += blocks * SHA1_BLOCK_SIZE;
+    length -= blocks * SHA1_BLOCK_SIZE;
+  }
+
+  if (length > 0) {
+    std::memcpy(ctx.block, data, length);
+    ctx.blockLength = length;
   }
-  
-  // Step 3: Calculate inner hash: SHA1(innerPadded || data)
-  buffers.innerData.resize(blockSize + dataBytes.size());
-  std::memcpy(buffers.innerData.data(), buffers.innerPadded.data(), blockSize);
-  std::memcpy(buffers.innerData.data() + blockSize, dataBytes.data(), dataBytes.size());
-  
-  std::vector<uint8_t> innerHash = sha1(buffers.innerData);
-  
-  // Step 4: Calculate outer hash: SHA1(outerPadded || innerHash)
-  buffers.outerData.resize(blockSize + innerHash.size());
-  std::memcpy(buffers.outerData.data(), buffers.outerPadded.data(), blockSize);
-  std::memcpy(buffers.outerData.data() + blockSize, innerHash.data(), innerHash.size());
-  
-  return vectorToArrayBuffer(sha1(buffers.outerData));
 }
 
-std::vector<uint8_t> Hmac::sha1(const std::vector<uint8_t>& data) {
-  // Initialize hash values (h0, h1, h2, h3, h4) - constexpr for compile-time optimization
-  constexpr uint32_t h0_init = 0x67452301;
-  constexpr uint32_t h1_init = 0xEFCDAB89;
-  constexpr uint32_t h2_init = 0x98BADCFE;
-  constexpr uint32_t h3_init = 0x10325476;
-  constexpr uint32_t h4_init = 0xC3D2E1F0;
-  
+void Hmac::sha1Final(Sha1Context& ctx, uint8_t out[SHA1_DIGEST_SIZE]) noexcept {
+  const uint64_t bitLength = ctx.length * 8;
+
+  // Padding: 0x80, zeros up to 56 mod 64, then the 64-bit big-endian bit length
+  ctx.block[ctx.blockLength++] = 0x80;
+  if (ctx.blockLength > SHA1_BLOCK_SIZE - 8) {
+    std::memset(ctx.block + ctx.blockLength, 0, SHA1_BLOCK_SIZE - ctx.blockLength);
+    sha1Compress(ctx.h, ctx.block, 1);
+    ctx.blockLength = 0;
+  }
+  std::memset(ctx.block + ctx.blockLength, 0, SHA1_BLOCK_SIZE - 8 - ctx.blockLength);
+  for (int i = 0; i < 8; i++) {
+    ctx.block[SHA1_BLOCK_SIZE - 1 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+  }
+  sha1Compress(ctx.h, ctx.block, 1);
+
+  // Convert to bytes
+  for (int i = 0; i < 5; i++) {
+    out[i * 4] = (ctx.h[i] >> 24) & 0xFF;
+    out[i * 4 + 1] = (ctx.h[i] >> 16) & 0xFF;
+    out[i * 4 + 2] = (ctx.h[i] >> 8) & 0xFF;
+    out[i * 4 + 3] = ctx.h[i] & 0xFF;
+  }
+}
+
+void Hmac::sha1Compress(uint32_t h[5], const uint8_t* blocks, size_t count) noexcept {
+  // Runtime CPU feature detection, resolved once
+  static const Sha1CompressFn impl = [] {
+    Sha1CompressFn hw = sha1HardwareCompress();
+    return hw ? hw : &Hmac::sha1CompressPortable;
+  }();
+  impl(h, blocks, count);
+}
+
+void Hmac::sha1CompressPortable(uint32_t h[5], const uint8_t* blocks, size_t count) {
   // SHA-1 constants - constexpr for compile-time optimization
   constexpr uint32_t k1 = 0x5A827999;
   constexpr uint32_t k2 = 0x6ED9EBA1;
   constexpr uint32_t k3 = 0x8F1BBCDC;
   constexpr uint32_t k4 = 0xCA62C1D6;
-  
-  uint32_t h[5] = {h0_init, h1_init, h2_init, h3_init, h4_init};
-  
-  // Pre-processing
-  size_t msgLength = data.size();
-  uint64_t bitLength = msgLength * 8;
-  
-  std::vector<uint8_t> padded;
-  padded.reserve(((msgLength + 9) / 64 + 1) * 64);
-  padded.insert(padded.end(), data.begin(), data.end());
-  padded.push_back(0x80);
-  
-  while ((padded.size() * 8) % 512 != 448) {
-    padded.push_back(0);
-  }
-  
-  for (int i = 7; i >= 0; i--) {
-    padded.push_back((bitLength >> (i * 8)) & 0xFF);
-  }
-  
-  // Process in 512-bit chunks
-  for (size_t chunk = 0; chunk < padded.size(); chunk += 64) {
+
+  for (; count > 0; count--, blocks += SHA1_BLOCK_SIZE) {
     uint32_t w[80];
     
     for (int i = 0; i < 16; i++) {
-      w[i] = (static_cast<uint32_t>(padded[chunk + i * 4]) << 24) |
-             (static_cast<uint32_t>(padded[chunk + i * 4 + 1]) << 16) |
-             (static_cast<uint32_t>(padded[chunk + i * 4 + 2]) << 8) |
-             static_cast<uint32_t>(padded[chunk + i * 4 + 3]);
+      w[i] = (static_cast<uint32_t>(blocks[i * 4]) << 24) |
+             (static_cast<uint32_t>(blocks[i * 4 + 1]) << 16) |
+             (static_cast<uint32_t>(blocks[i * 4 + 2]) << 8) |
+             static_cast<uint32_t>(blocks[i * 4 + 3]);
     }
     
     for (int i = 16; i < 80; i++) {
@@ -112,30 +186,24 @@ std::vector<uint8_t> Hmac::sha1(const std::vector<uint8_t>& data) {
     }
     
     uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
-    
-    for (int i = 0; i < 80; i++) {
-      uint32_t f, k;
-      
-      if (i < 20) {
-        f = (b & c) | (~b & d);
-        k = k1;
-      } else if (i < 40) {
-        f = b ^ c ^ d;
-        k = k2;
-      } else if (i < 60) {
-        f = (b & c) | (b & d) | (c & d);
-        k = k3;
-      } else {
-        f = b ^ c ^ d;
-        k = k4;
-      }
-      
-      uint32_t temp = leftRotate(a, 5) + f + e + k + w[i];
-      e = d;
-      d = c;
-      c = leftRotate(b, 30);
-      b = a;
-      a = temp;
+    uint32_t temp;
+
+    // One loop per round function: no branch on i inside the rounds
+    for (int i = 0; i < 20; i++) {
+      temp = leftRotate(a, 5) + ((b & c) | (~b & d)) + e + k1 + w[i];
+      e = d; d = c; c = leftRotate(b, 30); b = a; a = temp;
+    }
+    for (int i = 20; i < 40; i++) {
+      temp = leftRotate(a, 5) + (b ^ c ^ d) + e + k2 + w[i];
+      e = d; d = c; c = leftRotate(b, 30); b = a; a = temp;
+    }
+    for (int i = 40; i < 60; i++) {
+      temp = leftRotate(a, 5) + ((b & c) | (b & d) | (c & d)) + e + k3 + w[i];
+      e = d; d = c; c = leftRotate(b, 30); b = a; a = temp;
+    }
+    for (int i = 60; i < 80; i++) {
+      temp = leftRotate(a, 5) + (b ^ c ^ d) + e + k4 + w[i];
+      e = d; d = c; c = leftRotate(b, 30); b = a; a = temp;
     }
     
     h[0] += a;
@@ -144,38 +212,10 @@ std::vector<uint8_t> Hmac::sha1(const std::vector<uint8_t>& data) {
     h[3] += d;
     h[4] += e;
   }
-  
-  // Convert to bytes
-  std::vector<uint8_t> result(20);
-  for (int i = 0; i < 5; i++) {
-    result[i * 4] = (h[i] >> 24) & 0xFF;
-    result[i * 4 + 1] = (h[i] >> 16) & 0xFF;
-    result[i * 4 + 2] = (h[i] >> 8) & 0xFF;
-    result[i * 4 + 3] = h[i] & 0xFF;
-  }
-  
-  return result;
 }
 
 constexpr uint32_t Hmac::leftRotate(uint32_t value, int amount) noexcept {
   return (value << amount) | (value >> (32 - amount));
 }
 
-std::vector<uint8_t> Hmac::arrayBufferToVector(const std::shared_ptr<ArrayBuffer>& buffer) {
-  if (!buffer) {
-    throw std::invalid_argument("Buffer must not be null");
-  }
-  
-  const uint8_t* data = static_cast<const uint8_t*>(buffer->data());
-  return std::vector<uint8_t>(data, data + buffer->size());
-}
-
-std::shared_ptr<ArrayBuffer> Hmac::vectorToArrayBuffer(const std::vector<uint8_t>& data) {
-  if (data.empty()) {
-    return ArrayBuffer::allocate(0);
-  }
-  
-  return ArrayBuffer::copy(data);
-}
-
-} // namespace margelo::nitro::concealcrypto
\ No newline at end of file
+} // namespace margelo::nitro::concealcrypto
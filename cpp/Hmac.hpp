@@ -8,12 +8,34 @@
  */
 #pragma once
 #include <NitroModules/ArrayBuffer.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <string>
-#include <vector>
 
 namespace margelo::nitro::concealcrypto {
 
+// SHA-1 block and digest sizes
+constexpr size_t SHA1_BLOCK_SIZE = 64;
+constexpr size_t SHA1_DIGEST_SIZE = 20;
+
+/**
+ * Fixed-size streaming SHA-1 state (no heap allocation)
+ */
+struct Sha1Context {
+  uint32_t h[5];
+  uint64_t length;                 // total bytes absorbed
+  uint8_t block[SHA1_BLOCK_SIZE];  // pending partial block
+  size_t blockLength;
+};
+
+/**
+ * Precomputed HMAC-SHA1 key: SHA-1 midstates after absorbing key^ipad and key^opad
+ */
+struct HmacSha1State {
+  Sha1Context inner;
+  Sha1Context outer;
+};
+
 /**
  * HMAC-SHA1 implementation following RFC 2104 and FIPS 198-1
  * Used for TOTP computation and other cryptographic operations
@@ -31,46 +53,57 @@ public:
     const std::shared_ptr<ArrayBuffer>& data
   );
 
-private:
-  // Performance optimization: pre-allocated thread-local buffers to reduce heap allocations
-  // Since HMAC is called frequently (e.g., TOTP every 30s, transaction signing), this reduces overhead
-  struct HmacBuffers {
-    std::vector<uint8_t> innerPadded;
-    std::vector<uint8_t> outerPadded;
-    std::vector<uint8_t> innerData;
-    std::vector<uint8_t> outerData;
-  };
-  static thread_local HmacBuffers buffers;
+  /**
+   * Compute HMAC-SHA1 over raw memory
+   * @param out Receives the 20-byte MAC
+   */
+  static void hmacSha1(const uint8_t* key, size_t keyLength,
+                       const uint8_t* data, size_t dataLength,
+                       uint8_t out[SHA1_DIGEST_SIZE]) noexcept;
 
-private:
   /**
-   * SHA-1 hash function implementation
-   * @param data Input data to hash
-   * @return SHA-1 hash as vector of bytes (20 bytes)
+   * Precompute the inner/outer midstates for a key
+   * A MAC then only costs the message blocks plus one final block per hash.
    */
-  static std::vector<uint8_t> sha1(const std::vector<uint8_t>& data);
+  static void hmacSha1Init(HmacSha1State& state, const uint8_t* key, size_t keyLength) noexcept;
 
   /**
-   * Left rotate operation for SHA-1
-   * @param value Value to rotate
-   * @param amount Number of bits to rotate left
-   * @return Rotated value
+   * Compute HMAC-SHA1 from precomputed midstates (state is not modified)
+   * @param out Receives the 20-byte MAC
    */
-  static constexpr uint32_t leftRotate(uint32_t value, int amount) noexcept;
+  static void hmacSha1Mac(const HmacSha1State& state, const uint8_t* data, size_t dataLength,
+                          uint8_t out[SHA1_DIGEST_SIZE]) noexcept;
+
+  /**
+   * Streaming SHA-1: init / update / final on a 64-byte block buffer
+   */
+  static void sha1Init(Sha1Context& ctx) noexcept;
+  static void sha1Update(Sha1Context& ctx, const uint8_t* data, size_t length) noexcept;
+  static void sha1Final(Sha1Context& ctx, uint8_t out[SHA1_DIGEST_SIZE]) noexcept;
 
+private:
   /**
-   * Convert ArrayBuffer to vector of bytes
-   * @param buffer Input ArrayBuffer
-   * @return Vector of bytes
+   * SHA-1 compression of consecutive 64-byte blocks into the chaining state
+   * Dispatches once to the hardware implementation (SHA-NI / ARMv8 SHA1)
+   * when the CPU supports it, otherwise to sha1CompressPortable.
+   * @param h Chaining state (5 words)
+   * @param blocks Input blocks
+   * @param count Number of blocks
    */
-  static std::vector<uint8_t> arrayBufferToVector(const std::shared_ptr<ArrayBuffer>& buffer);
+  static void sha1Compress(uint32_t h[5], const uint8_t* blocks, size_t count) noexcept;
 
   /**
-   * Convert vector of bytes to ArrayBuffer
-   * @param data Vector of bytes
-   * @return ArrayBuffer
+   * Portable SHA-1 compression (reference for the hardware paths)
    */
-  static std::shared_ptr<ArrayBuffer> vectorToArrayBuffer(const std::vector<uint8_t>& data);
+  static void sha1CompressPortable(uint32_t h[5], const uint8_t* blocks, size_t count);
+
+  /**
+   * Left rotate operation for SHA-1
+   * @param value Value to rotate
+   * @param amount Number of bits to rotate left
+   * @return Rotated value
+   */
+  static constexpr uint32_t leftRotate(uint32_t value, int amount) noexcept;
 };
 
 } // namespace margelo::nitro::concealcrypto
@@ -7,13 +7,21 @@
  * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
  */
 #include "HybridConcealCrypto.hpp"
+#include "AsyncTask.hpp"
 #include "HybridCryptonote.hpp"
+#include "HybridSecretStream.hpp"
+#include "ParallelChacha.hpp"
 #include "chacha.h"
+#include "Otp.hpp"
+#include "HexCodec.hpp"
+#include "Base64Codec.hpp"
+#include "Mnemonic.hpp"
 #include "mn_random.h"
 #include <sodium.h>
-#include <sstream>
-#include <iomanip>
+#include <cmath>
+#include <cstring>
 #include <stdexcept>
+#include <string>
 
 using namespace margelo::nitro;
 using namespace margelo::nitro::concealcrypto;
@@ -37,16 +45,11 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::hextobin(const std::string& he
   if (hex.size() % 2 != 0)
     throw std::invalid_argument("Hex string must have even length");
 
-  std::vector<uint8_t> binary;
-  binary.reserve(hex.size() / 2);
-
-  for (size_t i = 0; i < hex.size(); i += 2) {
-    std::string byteString = hex.substr(i, 2);
-    char byte = static_cast<char>(strtol(byteString.c_str(), nullptr, 16));
-    binary.push_back(static_cast<uint8_t>(byte));
-  }
+  auto binary = ArrayBuffer::allocate(hex.size() / 2);
+  if (!HexCodec::decode(hex.data(), hex.size(), binary->data()))
+    throw std::invalid_argument("Invalid hex string format");
   
-  return ArrayBuffer::copy(binary);
+  return binary;
 }
 
 /**
@@ -55,74 +58,131 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::hextobin(const std::string& he
 std::string HybridConcealCrypto::bintohex(const std::shared_ptr<ArrayBuffer>& buffer) {
   if (!buffer) throw std::invalid_argument("Buffer must not be null");
   
-  std::ostringstream oss;
-  oss << std::hex << std::setfill('0');
-  
-  const uint8_t* data = static_cast<const uint8_t*>(buffer->data());
-  for (size_t i = 0; i < buffer->size(); ++i) {
-    oss << std::setw(2) << static_cast<int>(data[i]);
-  }
-  
-  return oss.str();
+  return HexCodec::encode(static_cast<const uint8_t*>(buffer->data()), buffer->size());
 }
 
 /**
- * Converts binary bytes into a base64 string using libsodium.
- * Uses standard base64 with padding to match nacl.util.encodeBase64().
+ * Converts binary bytes into a base64 string, encoded straight into the result.
+ * Defaults to standard base64 with padding to match nacl.util.encodeBase64().
  */
-std::string HybridConcealCrypto::bin2base64(const std::shared_ptr<ArrayBuffer>& buffer) {
+std::string HybridConcealCrypto::bin2base64(
+  const std::shared_ptr<ArrayBuffer>& buffer,
+  const std::optional<std::string>& variant
+) {
   if (!buffer) throw std::invalid_argument("Buffer must not be null");
   
-  const uint8_t* bin = static_cast<const uint8_t*>(buffer->data());
-  size_t bin_len = buffer->size();
-  
-  // Calculate required base64 output size (standard variant with padding)
-  size_t base64_len = sodium_base64_ENCODED_LEN(bin_len, sodium_base64_VARIANT_ORIGINAL);
-  std::vector<char> base64(base64_len);
-  
-  // Convert to base64 using libsodium (standard variant)
-  char* result = sodium_bin2base64(
-    base64.data(),
-    base64_len,
-    bin,
-    bin_len,
-    sodium_base64_VARIANT_ORIGINAL
+  return Base64Codec::encode(
+    static_cast<const uint8_t*>(buffer->data()),
+    buffer->size(),
+    Base64Codec::parseVariant(variant.value_or("original"))
   );
-  
-  if (!result) throw std::runtime_error("Base64 encoding failed");
-  
-  return std::string(base64.data());
 }
 
 /**
- * Converts a base64 string into binary bytes using libsodium.
- * Uses standard base64 to match nacl.util.decodeBase64().
+ * Converts a base64 string into binary bytes.
+ * Defaults to standard base64 to match nacl.util.decodeBase64().
  */
-std::shared_ptr<ArrayBuffer> HybridConcealCrypto::base642bin(const std::string& base64) {
+std::shared_ptr<ArrayBuffer> HybridConcealCrypto::base642bin(
+  const std::string& base64,
+  const std::optional<std::string>& variant
+) {
   if (base64.empty()) throw std::invalid_argument("Base64 string must not be empty");
+  Base64Codec::Variant v = Base64Codec::parseVariant(variant.value_or("original"));
   
-  // Allocate buffer for binary output (max size)
-  std::vector<uint8_t> bin(base64.size()); // Max possible size
+  // Exact output size from the length and padding, then decode in place
   size_t bin_len;
+  if (!Base64Codec::decodedLength(base64.data(), base64.size(), v, bin_len))
+    throw std::runtime_error("Base64 decoding failed");
   
-  // Convert from base64 using libsodium (standard variant)
-  int result = sodium_base642bin(
-    bin.data(),
-    bin.size(),
-    base64.c_str(),
-    base64.size(),
-    nullptr,  // ignore characters
-    &bin_len, // actual output length
-    nullptr,  // base64_end (not needed)
-    sodium_base64_VARIANT_ORIGINAL
-  );
-  
-  if (result != 0) throw std::runtime_error("Base64 decoding failed");
-  
-  // Resize to actual length
-  bin.resize(bin_len);
+  auto bin = ArrayBuffer::allocate(bin_len);
+  if (!Base64Codec::decode(base64.data(), base64.size(), bin->data(), v))
+    throw std::runtime_error("Base64 decoding failed");
   
-  return ArrayBuffer::copy(bin);
+  return bin;
+}
+
+/**
+ * Batch base64 encoding of n buffers packed back to back, delimited by offsets
+ * (Uint32Array of n + 1 entries, as in secretboxOpenBatch)
+ */
+std::vector<std::string> HybridConcealCrypto::bin2base64Batch(
+  const std::shared_ptr<ArrayBuffer>& packed,
+  const std::shared_ptr<ArrayBuffer>& offsets,
+  const std::optional<std::string>& variant
+) {
+  if (!packed || !offsets)
+    throw std::invalid_argument("Packed buffer and offsets must not be null");
+  if (offsets->size() < sizeof(uint32_t) || offsets->size() % sizeof(uint32_t) != 0)
+    throw std::invalid_argument("Offsets must be a Uint32Array of count + 1 entries");
+  Base64Codec::Variant v = Base64Codec::parseVariant(variant.value_or("original"));
+
+  const size_t count = offsets->size() / sizeof(uint32_t) - 1;
+  const uint8_t* data = static_cast<const uint8_t*>(packed->data());
+  const uint8_t* offsetBytes = static_cast<const uint8_t*>(offsets->data());
+  auto offsetAt = [offsetBytes](size_t i) {
+    uint32_t value;
+    std::memcpy(&value, offsetBytes + i * sizeof(uint32_t), sizeof(value));
+    return static_cast<size_t>(value);
+  };
+
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    size_t start = offsetAt(i);
+    size_t end = offsetAt(i + 1);
+    if (start > end || end > packed->size())
+      throw std::invalid_argument("Offset out of range at index " + std::to_string(i));
+    result.push_back(Base64Codec::encode(data + start, end - start, v));
+  }
+  return result;
+}
+
+/**
+ * Batch base64 decoding into one contiguous buffer.
+ * Output sizes come from each string's length and padding, so every string is
+ * decoded straight into its slot; a malformed string only zero-fills its own
+ * slot (empty if its length is impossible) and clears its status byte.
+ */
+Base64BatchResult HybridConcealCrypto::base642binBatch(
+  const std::vector<std::string>& base64s,
+  const std::optional<std::string>& variant
+) {
+  Base64Codec::Variant v = Base64Codec::parseVariant(variant.value_or("original"));
+  const size_t count = base64s.size();
+
+  std::vector<size_t> lengths(count);
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!Base64Codec::decodedLength(base64s[i].data(), base64s[i].size(), v, lengths[i])) lengths[i] = 0;
+    total += lengths[i];
+  }
+  if (total > UINT32_MAX)
+    throw std::invalid_argument("Decoded batch exceeds the 4 GiB offset range");
+
+  auto data = ArrayBuffer::allocate(total);
+  auto dataOffsets = ArrayBuffer::allocate((count + 1) * sizeof(uint32_t));
+  auto status = ArrayBuffer::allocate(count);
+
+  uint8_t* out = static_cast<uint8_t*>(data->data());
+  uint8_t* outOffsets = static_cast<uint8_t*>(dataOffsets->data());
+  uint8_t* outStatus = static_cast<uint8_t*>(status->data());
+
+  size_t position = 0;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t position32 = static_cast<uint32_t>(position);
+    std::memcpy(outOffsets + i * sizeof(uint32_t), &position32, sizeof(position32));
+
+    bool ok = Base64Codec::decode(base64s[i].data(), base64s[i].size(), out + position, v);
+    if (!ok) {
+      std::memset(out + position, 0, lengths[i]);
+    }
+    outStatus[i] = ok ? 1 : 0;
+    position += lengths[i];
+  }
+  uint32_t total32 = static_cast<uint32_t>(total);
+  std::memcpy(outOffsets + count * sizeof(uint32_t), &total32, sizeof(total32));
+
+  return Base64BatchResult(data, dataOffsets, status);
 }
 
 /**
@@ -140,19 +200,20 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::chacha8(
   if (iv->size() != CHACHA_IV_SIZE)
     throw std::invalid_argument("IV must be exactly 8 bytes");
 
-  // Allocate output buffer
-  std::vector<uint8_t> output(input->size());
+  // Allocate the result buffer and write into it directly
+  auto output = ArrayBuffer::allocate(input->size());
   
-  // Call the modern ChaCha8 XOR function
-  chacha8_xor(
+  // ChaCha8 XOR, split across the thread pool for large inputs
+  ParallelChacha::xorStream(
     static_cast<const uint8_t*>(input->data()),   // input data
     input->size(),                                // input length
     static_cast<const uint8_t*>(key->data()),     // key
     static_cast<const uint8_t*>(iv->data()),     // iv
-    output.data()                                 // output
+    output->data(),                               // output
+    8                                            // rounds
   );
 
-  return ArrayBuffer::copy(output);
+  return output;
 }
 
 /**
@@ -170,19 +231,64 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::chacha12(
   if (iv->size() != CHACHA_IV_SIZE)
     throw std::invalid_argument("IV must be exactly 8 bytes");
 
-  // Allocate output buffer
-  std::vector<uint8_t> output(input->size());
+  // Allocate the result buffer and write into it directly
+  auto output = ArrayBuffer::allocate(input->size());
   
-  // Call the modern ChaCha12 XOR function
-  chacha12_xor(
+  // ChaCha12 XOR, split across the thread pool for large inputs
+  ParallelChacha::xorStream(
     static_cast<const uint8_t*>(input->data()),   // input data
     input->size(),                                // input length
     static_cast<const uint8_t*>(key->data()),     // key
     static_cast<const uint8_t*>(iv->data()),     // iv
-    output.data()                                 // output
+    output->data(),                               // output
+    12                                           // rounds
   );
 
-  return ArrayBuffer::copy(output);
+  return output;
+}
+
+/**
+ * ChaCha20 encryption.
+ * An 8-byte nonce selects the original layout (64-bit block counter),
+ * a 12-byte nonce the IETF RFC 8439 layout (32-bit block counter).
+ */
+std::shared_ptr<ArrayBuffer> HybridConcealCrypto::chacha20(
+  const std::shared_ptr<ArrayBuffer>& input,
+  const std::shared_ptr<ArrayBuffer>& key,
+  const std::shared_ptr<ArrayBuffer>& nonce,
+  double counter
+) {
+  if (!input || !key || !nonce) 
+    throw std::invalid_argument("Input, key and nonce must not be null");
+  if (key->size() != CHACHA_KEY_SIZE)
+    throw std::invalid_argument("Key must be exactly 32 bytes");
+  if (nonce->size() != CHACHA_IV_SIZE && nonce->size() != CHACHA_NONCE_SIZE)
+    throw std::invalid_argument("Nonce must be exactly 8 or 12 bytes");
+  // Range check first: casting NaN or values >= 2^64 to uint64_t is undefined
+  if (!(counter >= 0 && counter < 18446744073709551616.0) || counter != std::floor(counter))
+    throw std::invalid_argument("Counter must be a non-negative integer");
+
+  const uint64_t initialCounter = static_cast<uint64_t>(counter);
+  const uint64_t blocks = (input->size() + CHACHA_BLOCK_SIZE - 1) / CHACHA_BLOCK_SIZE;
+  const bool ietf = nonce->size() == CHACHA_NONCE_SIZE;
+  if (ietf && initialCounter + blocks > (uint64_t{1} << 32))
+    throw std::invalid_argument("Input too long for the 32-bit IETF block counter");
+
+  // Allocate the result buffer and write into it directly
+  auto output = ArrayBuffer::allocate(input->size());
+
+  const uint8_t* in = static_cast<const uint8_t*>(input->data());
+  const uint8_t* k = static_cast<const uint8_t*>(key->data());
+  const uint8_t* n = static_cast<const uint8_t*>(nonce->data());
+
+  if (ietf) {
+    ParallelChacha::xorStreamIetf(in, input->size(), k, n, static_cast<uint32_t>(initialCounter),
+                                  output->data(), 20);
+  } else {
+    ParallelChacha::xorStream(in, input->size(), k, n, output->data(), 20, initialCounter);
+  }
+
+  return output;
 }
 
 /**
@@ -195,6 +301,91 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::hmacSha1(
   return Hmac::hmacSha1(key, data);
 }
 
+/**
+ * Precomputed HMAC-SHA1 key for repeated MACs with the same key
+ */
+std::shared_ptr<HybridHmacKeySpec> HybridConcealCrypto::createHmacKey(
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  return std::make_shared<HybridHmacKey>(key);
+}
+
+/**
+ * HOTP (RFC 4226) code for one counter value
+ */
+std::string HybridConcealCrypto::hotp(
+  const std::shared_ptr<ArrayBuffer>& secret,
+  double counter,
+  double digits,
+  const std::string& algorithm
+) {
+  if (!secret) throw std::invalid_argument("Secret must not be null");
+  if (!(counter >= 0 && counter < 18446744073709551616.0) || counter != std::floor(counter))
+    throw std::invalid_argument("HOTP counter must be a non-negative integer");
+  int nDigits = Otp::checkDigits(digits);
+
+  Otp::Key key;
+  Otp::initKey(key, Otp::parseAlgorithm(algorithm), static_cast<const uint8_t*>(secret->data()), secret->size());
+  uint32_t value = Otp::hotp(key, static_cast<uint64_t>(counter), nDigits);
+  sodium_memzero(&key, sizeof(key));
+
+  return Otp::format(value, nDigits);
+}
+
+/**
+ * TOTP (RFC 6238) code for a Unix time in seconds
+ */
+std::string HybridConcealCrypto::totp(
+  const std::shared_ptr<ArrayBuffer>& secret,
+  double time,
+  double step,
+  double digits,
+  const std::string& algorithm
+) {
+  if (!secret) throw std::invalid_argument("Secret must not be null");
+  int nDigits = Otp::checkDigits(digits);
+  uint64_t counter = Otp::timeCounter(time, step);
+
+  Otp::Key key;
+  Otp::initKey(key, Otp::parseAlgorithm(algorithm), static_cast<const uint8_t*>(secret->data()), secret->size());
+  uint32_t value = Otp::hotp(key, counter, nDigits);
+  sodium_memzero(&key, sizeof(key));
+
+  return Otp::format(value, nDigits);
+}
+
+/**
+ * Verify a TOTP code against time steps [-window, +window] in one call.
+ * The HMAC key state is precomputed once and every step is checked
+ * (no early exit) with a constant-time comparison.
+ * Defaults: step = 30 seconds, algorithm = "SHA1", digits = 6. A code of any
+ * other length than digits is rejected, never checked against a shorter truncation.
+ */
+bool HybridConcealCrypto::verifyTotp(
+  const std::shared_ptr<ArrayBuffer>& secret,
+  const std::string& code,
+  double time,
+  double window,
+  const std::optional<double>& step,
+  const std::optional<std::string>& algorithm,
+  const std::optional<double>& digits
+) {
+  if (!secret) throw std::invalid_argument("Secret must not be null");
+  int nDigits = Otp::checkDigits(digits.value_or(6));
+  if (!(window >= 0 && window <= 100) || window != static_cast<double>(static_cast<int>(window)))
+    throw std::invalid_argument("TOTP window must be an integer between 0 and 100");
+
+  uint64_t counter = Otp::timeCounter(time, step.value_or(30));
+
+  Otp::Key key;
+  Otp::initKey(key, Otp::parseAlgorithm(algorithm.value_or("SHA1")),
+               static_cast<const uint8_t*>(secret->data()), secret->size());
+  bool match = Otp::verify(key, code, counter, static_cast<int>(window), nDigits);
+  sodium_memzero(&key, sizeof(key));
+
+  return match;
+}
+
 /**
  * Clean JavaScript API for mnemonic-style random generation
  */
@@ -206,8 +397,31 @@ std::string HybridConcealCrypto::random(double bits) {
  * Clean JavaScript API for random bytes generation
  */
 std::shared_ptr<ArrayBuffer> HybridConcealCrypto::randomBytes(double bytes) {
-  std::vector<uint8_t> random_data = ::mn_random_bytes(bytes);
-  return ArrayBuffer::copy(random_data);
+  int count = static_cast<int>(bytes);
+  if (count <= 0)
+    throw std::invalid_argument("mn_random_bytes failed: Number of bytes must be positive");
+
+  auto random_data = ArrayBuffer::allocate(static_cast<size_t>(count));
+  ::mn_random_fill(random_data->data(), random_data->size());
+  return random_data;
+}
+
+/**
+ * Electrum-style mnemonic encoding of seed entropy
+ */
+std::string HybridConcealCrypto::mnemonicEncode(const std::shared_ptr<ArrayBuffer>& entropy, const std::string& lang) {
+  if (!entropy) throw std::invalid_argument("Entropy must not be null");
+  return Mnemonic::encode(static_cast<const uint8_t*>(entropy->data()), entropy->size(), lang);
+}
+
+/**
+ * Electrum-style mnemonic decoding back to seed entropy
+ */
+std::shared_ptr<ArrayBuffer> HybridConcealCrypto::mnemonicDecode(const std::string& words) {
+  std::vector<uint8_t> entropy = Mnemonic::decode(words);
+  auto buffer = ArrayBuffer::copy(entropy);
+  sodium_memzero(entropy.data(), entropy.size());
+  return buffer;
 }
 
 /**
@@ -226,10 +440,10 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::secretbox(
     throw std::invalid_argument("Invalid key size");
 
   size_t cipher_len = message->size() + crypto_secretbox_MACBYTES;
-  std::vector<uint8_t> ciphertext(cipher_len);
+  auto ciphertext = ArrayBuffer::allocate(cipher_len);
 
   int result = crypto_secretbox_easy(
-    ciphertext.data(),
+    ciphertext->data(),
     static_cast<const unsigned char*>(message->data()),
     message->size(),
     static_cast<const unsigned char*>(nonce->data()),
@@ -239,7 +453,7 @@ std::shared_ptr<ArrayBuffer> HybridConcealCrypto::secretbox(
   if (result != 0)
     throw std::runtime_error("Secretbox encryption failed");
 
-  return ArrayBuffer::copy(ciphertext);
+  return ciphertext;
 }
 
 /**
@@ -261,10 +475,10 @@ std::optional<std::shared_ptr<ArrayBuffer>> HybridConcealCrypto::secretboxOpen(
     throw std::invalid_argument("Invalid key size");
 
   size_t message_len = ciphertext->size() - crypto_secretbox_MACBYTES;
-  std::vector<uint8_t> message(message_len);
+  auto message = ArrayBuffer::allocate(message_len);
 
   int result = crypto_secretbox_open_easy(
-    message.data(),
+    message->data(),
     static_cast<const unsigned char*>(ciphertext->data()),
     ciphertext->size(),
     static_cast<const unsigned char*>(nonce->data()),
@@ -274,7 +488,214 @@ std::optional<std::shared_ptr<ArrayBuffer>> HybridConcealCrypto::secretboxOpen(
   if (result != 0)
     return std::nullopt; // Authentication failed
 
-  return ArrayBuffer::copy(message);
+  return message;
+}
+
+/**
+ * Batch libsodium secretbox decryption (e.g. all in-wallet messages of one sync)
+ * packedCiphertexts holds n ciphertexts back to back, delimited by offsets
+ * (Uint32Array of n + 1 entries), with n 24-byte nonces packed in nonces.
+ * Plaintexts are opened straight into one contiguous buffer; a failed
+ * authentication only zero-fills its own slot and clears its status byte.
+ */
+SecretboxBatchResult HybridConcealCrypto::secretboxOpenBatch(
+  const std::shared_ptr<ArrayBuffer>& packedCiphertexts,
+  const std::shared_ptr<ArrayBuffer>& offsets,
+  const std::shared_ptr<ArrayBuffer>& nonces,
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  if (!packedCiphertexts || !offsets || !nonces || !key)
+    throw std::invalid_argument("Ciphertexts, offsets, nonces and key must not be null");
+  if (key->size() != crypto_secretbox_KEYBYTES)
+    throw std::invalid_argument("Invalid key size");
+  if (offsets->size() < sizeof(uint32_t) || offsets->size() % sizeof(uint32_t) != 0)
+    throw std::invalid_argument("Offsets must be a Uint32Array of count + 1 entries");
+
+  const size_t count = offsets->size() / sizeof(uint32_t) - 1;
+  if (nonces->size() != count * crypto_secretbox_NONCEBYTES)
+    throw std::invalid_argument("Invalid nonces size");
+
+  const uint8_t* packed = static_cast<const uint8_t*>(packedCiphertexts->data());
+  const uint8_t* offsetBytes = static_cast<const uint8_t*>(offsets->data());
+  auto offsetAt = [offsetBytes](size_t i) {
+    uint32_t value;
+    std::memcpy(&value, offsetBytes + i * sizeof(uint32_t), sizeof(value));
+    return static_cast<size_t>(value);
+  };
+
+  // Validate every slot before allocating the result
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t start = offsetAt(i);
+    size_t end = offsetAt(i + 1);
+    if (start > end || end > packedCiphertexts->size())
+      throw std::invalid_argument("Offset out of range at index " + std::to_string(i));
+    if (end - start < crypto_secretbox_MACBYTES)
+      throw std::invalid_argument("Ciphertext too short at index " + std::to_string(i));
+    total += end - start - crypto_secretbox_MACBYTES;
+  }
+
+  auto messages = ArrayBuffer::allocate(total);
+  auto messageOffsets = ArrayBuffer::allocate((count + 1) * sizeof(uint32_t));
+  auto status = ArrayBuffer::allocate(count);
+
+  uint8_t* out = static_cast<uint8_t*>(messages->data());
+  uint8_t* outOffsets = static_cast<uint8_t*>(messageOffsets->data());
+  uint8_t* outStatus = static_cast<uint8_t*>(status->data());
+  const uint8_t* nonce = static_cast<const uint8_t*>(nonces->data());
+  const unsigned char* k = static_cast<const unsigned char*>(key->data());
+
+  size_t position = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t start = offsetAt(i);
+    size_t length = offsetAt(i + 1) - start;
+    size_t messageLength = length - crypto_secretbox_MACBYTES;
+
+    uint32_t position32 = static_cast<uint32_t>(position);
+    std::memcpy(outOffsets + i * sizeof(uint32_t), &position32, sizeof(position32));
+
+    int result = crypto_secretbox_open_easy(
+      out + position,
+      packed + start,
+      length,
+      nonce + i * crypto_secretbox_NONCEBYTES,
+      k
+    );
+    if (result != 0) {
+      sodium_memzero(out + position, messageLength);
+    }
+    outStatus[i] = result == 0 ? 1 : 0;
+    position += messageLength;
+  }
+  uint32_t total32 = static_cast<uint32_t>(total);
+  std::memcpy(outOffsets + count * sizeof(uint32_t), &total32, sizeof(total32));
+
+  return SecretboxBatchResult(messages, messageOffsets, status);
+}
+
+/**
+ * Promise variants: arguments are retained (JS-owned buffers copied) on the JS
+ * thread, then the synchronous implementation runs on the shared ThreadPool.
+ * The task holds a reference to this object so it outlives a dropped JS handle.
+ */
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridConcealCrypto::chacha8Async(
+  const std::shared_ptr<ArrayBuffer>& input,
+  const std::shared_ptr<ArrayBuffer>& key,
+  const std::shared_ptr<ArrayBuffer>& iv
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::Normal,
+    [self, input = retainForAsync(input), key = retainForAsync(key), iv = retainForAsync(iv)] {
+      return self->chacha8(input, key, iv);
+    });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridConcealCrypto::chacha12Async(
+  const std::shared_ptr<ArrayBuffer>& input,
+  const std::shared_ptr<ArrayBuffer>& key,
+  const std::shared_ptr<ArrayBuffer>& iv
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::Normal,
+    [self, input = retainForAsync(input), key = retainForAsync(key), iv = retainForAsync(iv)] {
+      return self->chacha12(input, key, iv);
+    });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridConcealCrypto::chacha20Async(
+  const std::shared_ptr<ArrayBuffer>& input,
+  const std::shared_ptr<ArrayBuffer>& key,
+  const std::shared_ptr<ArrayBuffer>& nonce,
+  double counter
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::Normal,
+    [self, input = retainForAsync(input), key = retainForAsync(key), nonce = retainForAsync(nonce), counter] {
+      return self->chacha20(input, key, nonce, counter);
+    });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridConcealCrypto::secretboxAsync(
+  const std::shared_ptr<ArrayBuffer>& message,
+  const std::shared_ptr<ArrayBuffer>& nonce,
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::Normal,
+    [self, message = retainForAsync(message), nonce = retainForAsync(nonce), key = retainForAsync(key)] {
+      return self->secretbox(message, nonce, key);
+    });
+}
+
+std::shared_ptr<Promise<std::optional<std::shared_ptr<ArrayBuffer>>>> HybridConcealCrypto::secretboxOpenAsync(
+  const std::shared_ptr<ArrayBuffer>& ciphertext,
+  const std::shared_ptr<ArrayBuffer>& nonce,
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<std::optional<std::shared_ptr<ArrayBuffer>>>(TaskPriority::Normal,
+    [self, ciphertext = retainForAsync(ciphertext), nonce = retainForAsync(nonce), key = retainForAsync(key)] {
+      return self->secretboxOpen(ciphertext, nonce, key);
+    });
+}
+
+std::shared_ptr<Promise<SecretboxBatchResult>> HybridConcealCrypto::secretboxOpenBatchAsync(
+  const std::shared_ptr<ArrayBuffer>& packedCiphertexts,
+  const std::shared_ptr<ArrayBuffer>& offsets,
+  const std::shared_ptr<ArrayBuffer>& nonces,
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  auto self = std::dynamic_pointer_cast<HybridConcealCrypto>(shared_from_this());
+  return runAsync<SecretboxBatchResult>(TaskPriority::Low,
+    [self, packedCiphertexts = retainForAsync(packedCiphertexts), offsets = retainForAsync(offsets),
+     nonces = retainForAsync(nonces), key = retainForAsync(key)] {
+      return self->secretboxOpenBatch(packedCiphertexts, offsets, nonces, key);
+    });
+}
+
+/**
+ * Resize the shared worker pool behind the batch and *Async methods
+ */
+void HybridConcealCrypto::configureThreadPool(double threads) {
+  // At least one worker: with none, submit() would run *Async work inline on the JS thread
+  if (!(threads >= 1 && threads <= ThreadPool::MAX_THREADS) || std::floor(threads) != threads) {
+    throw std::invalid_argument("Thread count must be an integer between 1 and " + std::to_string(ThreadPool::MAX_THREADS));
+  }
+  ThreadPool::shared().resize(static_cast<size_t>(threads));
+}
+
+/**
+ * Snapshot of the shared pool's size, queue depths and counters
+ */
+ThreadPoolStats HybridConcealCrypto::getThreadPoolStats() {
+  ThreadPoolCounters counters = ThreadPool::shared().counters();
+  return ThreadPoolStats(
+    static_cast<double>(counters.threads),
+    static_cast<double>(counters.queueDepth[static_cast<size_t>(TaskPriority::High)]),
+    static_cast<double>(counters.queueDepth[static_cast<size_t>(TaskPriority::Normal)]),
+    static_cast<double>(counters.queueDepth[static_cast<size_t>(TaskPriority::Low)]),
+    static_cast<double>(counters.steals),
+    static_cast<double>(counters.executed)
+  );
+}
+
+/**
+ * Start a libsodium secretstream encryption (XChaCha20-Poly1305)
+ */
+std::shared_ptr<HybridSecretStreamPushSpec> HybridConcealCrypto::secretstreamInitPush(
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  return std::make_shared<HybridSecretStreamPush>(key);
+}
+
+/**
+ * Start a libsodium secretstream decryption from a pushed header
+ */
+std::shared_ptr<HybridSecretStreamPullSpec> HybridConcealCrypto::secretstreamInitPull(
+  const std::shared_ptr<ArrayBuffer>& header,
+  const std::shared_ptr<ArrayBuffer>& key
+) {
+  return std::make_shared<HybridSecretStreamPull>(header, key);
 }
 
 /**
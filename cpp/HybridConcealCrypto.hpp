@@ -9,7 +9,9 @@
 #pragma once
 #include "../nitrogen/generated/shared/c++/HybridConcealCryptoSpec.hpp"
 #include "Hmac.hpp"
+#include "HybridHmacKey.hpp"
 #include "HybridCryptonote.hpp"
+#include "HybridSecretStream.hpp"
 #include <vector>
 #include <string>
 #include <memory>
@@ -23,24 +25,79 @@ class HybridConcealCrypto : public HybridConcealCryptoSpec {
   // Basic crypto functions
   std::shared_ptr<ArrayBuffer> hextobin(const std::string& hex) override;
   std::string bintohex(const std::shared_ptr<ArrayBuffer>& buffer) override;
-  std::string bin2base64(const std::shared_ptr<ArrayBuffer>& buffer) override;
-  std::shared_ptr<ArrayBuffer> base642bin(const std::string& base64) override;
+  std::string bin2base64(const std::shared_ptr<ArrayBuffer>& buffer,
+                         const std::optional<std::string>& variant) override;
+  std::shared_ptr<ArrayBuffer> base642bin(const std::string& base64,
+                                          const std::optional<std::string>& variant) override;
+  std::vector<std::string> bin2base64Batch(const std::shared_ptr<ArrayBuffer>& packed,
+                                           const std::shared_ptr<ArrayBuffer>& offsets,
+                                           const std::optional<std::string>& variant) override;
+  Base64BatchResult base642binBatch(const std::vector<std::string>& base64s,
+                                    const std::optional<std::string>& variant) override;
   std::shared_ptr<ArrayBuffer> chacha8(const std::shared_ptr<ArrayBuffer>& input,
                                        const std::shared_ptr<ArrayBuffer>& key,
                                        const std::shared_ptr<ArrayBuffer>& iv) override;
   std::shared_ptr<ArrayBuffer> chacha12(const std::shared_ptr<ArrayBuffer>& input,
                                         const std::shared_ptr<ArrayBuffer>& key,
                                         const std::shared_ptr<ArrayBuffer>& iv) override;
+  std::shared_ptr<ArrayBuffer> chacha20(const std::shared_ptr<ArrayBuffer>& input,
+                                        const std::shared_ptr<ArrayBuffer>& key,
+                                        const std::shared_ptr<ArrayBuffer>& nonce,
+                                        double counter) override;
   std::shared_ptr<ArrayBuffer> hmacSha1(const std::shared_ptr<ArrayBuffer>& key,
                                         const std::shared_ptr<ArrayBuffer>& data) override;
+  std::shared_ptr<HybridHmacKeySpec> createHmacKey(const std::shared_ptr<ArrayBuffer>& key) override;
+  std::string hotp(const std::shared_ptr<ArrayBuffer>& secret, double counter, double digits,
+                   const std::string& algorithm) override;
+  std::string totp(const std::shared_ptr<ArrayBuffer>& secret, double time, double step, double digits,
+                   const std::string& algorithm) override;
+  bool verifyTotp(const std::shared_ptr<ArrayBuffer>& secret, const std::string& code, double time,
+                  double window, const std::optional<double>& step,
+                  const std::optional<std::string>& algorithm,
+                  const std::optional<double>& digits) override;
   std::string random(double bits) override;
   std::shared_ptr<ArrayBuffer> randomBytes(double bytes) override;
+  std::string mnemonicEncode(const std::shared_ptr<ArrayBuffer>& entropy, const std::string& lang) override;
+  std::shared_ptr<ArrayBuffer> mnemonicDecode(const std::string& words) override;
   std::shared_ptr<ArrayBuffer> secretbox(const std::shared_ptr<ArrayBuffer>& message,
                                          const std::shared_ptr<ArrayBuffer>& nonce,
                                          const std::shared_ptr<ArrayBuffer>& key) override;
   std::optional<std::shared_ptr<ArrayBuffer>> secretboxOpen(const std::shared_ptr<ArrayBuffer>& ciphertext,
                                                              const std::shared_ptr<ArrayBuffer>& nonce,
                                                              const std::shared_ptr<ArrayBuffer>& key) override;
+  SecretboxBatchResult secretboxOpenBatch(const std::shared_ptr<ArrayBuffer>& packedCiphertexts,
+                                          const std::shared_ptr<ArrayBuffer>& offsets,
+                                          const std::shared_ptr<ArrayBuffer>& nonces,
+                                          const std::shared_ptr<ArrayBuffer>& key) override;
+
+  // Promise variants, run on the shared ThreadPool
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha8Async(const std::shared_ptr<ArrayBuffer>& input,
+                                                                      const std::shared_ptr<ArrayBuffer>& key,
+                                                                      const std::shared_ptr<ArrayBuffer>& iv) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha12Async(const std::shared_ptr<ArrayBuffer>& input,
+                                                                       const std::shared_ptr<ArrayBuffer>& key,
+                                                                       const std::shared_ptr<ArrayBuffer>& iv) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha20Async(const std::shared_ptr<ArrayBuffer>& input,
+                                                                       const std::shared_ptr<ArrayBuffer>& key,
+                                                                       const std::shared_ptr<ArrayBuffer>& nonce,
+                                                                       double counter) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> secretboxAsync(const std::shared_ptr<ArrayBuffer>& message,
+                                                                        const std::shared_ptr<ArrayBuffer>& nonce,
+                                                                        const std::shared_ptr<ArrayBuffer>& key) override;
+  std::shared_ptr<Promise<std::optional<std::shared_ptr<ArrayBuffer>>>> secretboxOpenAsync(
+      const std::shared_ptr<ArrayBuffer>& ciphertext, const std::shared_ptr<ArrayBuffer>& nonce,
+      const std::shared_ptr<ArrayBuffer>& key) override;
+  std::shared_ptr<Promise<SecretboxBatchResult>> secretboxOpenBatchAsync(
+      const std::shared_ptr<ArrayBuffer>& packedCiphertexts, const std::shared_ptr<ArrayBuffer>& offsets,
+      const std::shared_ptr<ArrayBuffer>& nonces, const std::shared_ptr<ArrayBuffer>& key) override;
+
+  // Native thread pool
+  void configureThreadPool(double threads) override;
+  ThreadPoolStats getThreadPoolStats() override;
+
+  std::shared_ptr<HybridSecretStreamPushSpec> secretstreamInitPush(const std::shared_ptr<ArrayBuffer>& key) override;
+  std::shared_ptr<HybridSecretStreamPullSpec> secretstreamInitPull(const std::shared_ptr<ArrayBuffer>& header,
+                                                                   const std::shared_ptr<ArrayBuffer>& key) override;
 
   // Cryptonote property getter
   std::shared_ptr<HybridCryptonoteSpec> getCryptonote() override;
@@ -7,8 +7,18 @@
  * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
  */
 #include "HybridCryptonote.hpp"
+#include "AsyncTask.hpp"
+#include "HybridSecretKeyHandle.hpp"
+#include "Base58.hpp"
+#include "Transaction.hpp"
+#include "mn_random.h"
 #include <stdexcept>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <exception>
+#include <alloca.h>
+#include <sodium.h>
 
 // Include Conceal crypto headers
 #include "Cryptonote/CryptoTypes.h"
@@ -53,133 +63,63 @@ constexpr auto TAG = "Cryptonote";
  */
 HybridCryptonote::HybridCryptonote() : HybridObject(TAG) {}
 
-// Optimized generateKeyDerivation with hex string inputs (minimizes JSI overhead)
-std::string HybridCryptonote::generateKeyDerivation(
-  const std::string& publicKeyHex,
-  const std::string& secretKeyHex
-) {
-  // Fast validation
-  if (!validateHexInput(publicKeyHex) || !validateHexInput(secretKeyHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
+// ---------------------------------------------------------------------------
+// Raw 32-byte primitives shared by the hex and binary entry points
+// ---------------------------------------------------------------------------
 
-  // Use static buffers to avoid allocation
+static void keyDerivation(const uint8_t* pub, const uint8_t* sec, uint8_t* out) {
   crypto::PublicKey pub_key;
   crypto::SecretKey sec_key;
   crypto::KeyDerivation derivation;
+  std::memcpy(pub_key.data, pub, CRYPTONOTE_KEY_SIZE);
+  std::memcpy(sec_key.data, sec, CRYPTONOTE_KEY_SIZE);
 
-  // Fast hex decode in C++ (much faster than JS)
-  if (!cryptonote_utils::hextobin(publicKeyHex, pub_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in publicKey");
-  }
-  if (!cryptonote_utils::hextobin(secretKeyHex, sec_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in secretKey");
-  }
-
-  // Call optimized crypto function
-  if (!crypto::generate_key_derivation(pub_key, sec_key, derivation)) {
+  bool ok = crypto::generate_key_derivation(pub_key, sec_key, derivation);
+  sodium_memzero(sec_key.data, sizeof(sec_key.data));
+  if (!ok) {
     throw std::runtime_error("generate_key_derivation failed: invalid keys");
   }
-
-  // Fast hex encode and return
-  return cryptonote_utils::bintohex(derivation.data, CRYPTONOTE_DERIVATION_SIZE);
+  std::memcpy(out, derivation.data, CRYPTONOTE_DERIVATION_SIZE);
 }
 
-// Optimized derivePublicKey with hex string inputs
-std::string HybridCryptonote::derivePublicKey(
-  const std::string& derivationHex, 
-  double outputIndex, 
-  const std::string& publicKeyHex
-) {
-  // Fast validation
-  if (!validateHexInput(derivationHex) || !validateHexInput(publicKeyHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  // Use static buffers
+static void derivedPublicKey(const uint8_t* derivation, double outputIndex, const uint8_t* pub, uint8_t* out) {
   crypto::KeyDerivation deriv;
   crypto::PublicKey base_pub;
   crypto::PublicKey derived_key;
+  std::memcpy(deriv.data, derivation, CRYPTONOTE_DERIVATION_SIZE);
+  std::memcpy(base_pub.data, pub, CRYPTONOTE_KEY_SIZE);
 
-  // Fast hex decode
-  if (!cryptonote_utils::hextobin(derivationHex, deriv.data, CRYPTONOTE_DERIVATION_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in derivation");
-  }
-  if (!cryptonote_utils::hextobin(publicKeyHex, base_pub.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in publicKey");
-  }
-
-  // Call optimized crypto function
   if (!crypto::derive_public_key(deriv, static_cast<size_t>(outputIndex), base_pub, derived_key)) {
     throw std::runtime_error("derive_public_key failed");
   }
-
-  // Fast hex encode and return
-  return cryptonote_utils::bintohex(derived_key.data, CRYPTONOTE_KEY_SIZE);
+  std::memcpy(out, derived_key.data, CRYPTONOTE_KEY_SIZE);
 }
 
-// Optimized geScalarmult with hex string inputs
-std::string HybridCryptonote::geScalarmult(
-  const std::string& publicKeyHex,
-  const std::string& secretKeyHex
-) {
-  if (!validateHexInput(publicKeyHex) || !validateHexInput(secretKeyHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  crypto::PublicKey pub_key;
-  crypto::SecretKey sec_key;
-  crypto::PublicKey result;
-
-  if (!cryptonote_utils::hextobin(publicKeyHex, pub_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in publicKey");
-  }
-  if (!cryptonote_utils::hextobin(secretKeyHex, sec_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in secretKey");
-  }
-
-  // Perform pure scalar multiplication: result = sec_key * pub_key
+// result = sec * pub
+static void scalarmult(const uint8_t* pub, const uint8_t* sec, uint8_t* out) {
   ge_p3 point;
   ge_p2 result_p2;
-  
+
   // Convert public key bytes to ge_p3
-  if (ge_frombytes_vartime(&point, reinterpret_cast<const unsigned char*>(&pub_key)) != 0) {
+  if (ge_frombytes_vartime(&point, pub) != 0) {
     throw std::invalid_argument("Invalid public key (not on curve)");
   }
   
   // Perform scalar multiplication
-  ge_scalarmult(&result_p2, reinterpret_cast<const unsigned char*>(&sec_key), &point);
+  ge_scalarmult(&result_p2, sec, &point);
   
   // Convert result to bytes
-  ge_tobytes(reinterpret_cast<unsigned char*>(&result), &result_p2);
-
-  return cryptonote_utils::bintohex(result.data, CRYPTONOTE_POINT_SIZE);
+  ge_tobytes(out, &result_p2);
 }
 
-// Optimized geAdd with hex string inputs
-std::string HybridCryptonote::geAdd(
-  const std::string& point1Hex,
-  const std::string& point2Hex
-) {
-  if (!validateHexInput(point1Hex) || !validateHexInput(point2Hex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  crypto::PublicKey p1, p2, result;
-
-  if (!cryptonote_utils::hextobin(point1Hex, p1.data, CRYPTONOTE_POINT_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in point1");
-  }
-  if (!cryptonote_utils::hextobin(point2Hex, p2.data, CRYPTONOTE_POINT_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in point2");
-  }
-
+// result = p1 + p2
+static void pointAdd(const uint8_t* p1, const uint8_t* p2, uint8_t* out) {
   // Convert points to ge_p3 format
   ge_p3 point1, point2;
-  if (ge_frombytes_vartime(&point1, reinterpret_cast<const unsigned char*>(&p1)) != 0) {
+  if (ge_frombytes_vartime(&point1, p1) != 0) {
     throw std::invalid_argument("Invalid first point (not on curve)");
   }
-  if (ge_frombytes_vartime(&point2, reinterpret_cast<const unsigned char*>(&p2)) != 0) {
+  if (ge_frombytes_vartime(&point2, p2) != 0) {
     throw std::invalid_argument("Invalid second point (not on curve)");
   }
 
@@ -196,106 +136,36 @@ std::string HybridCryptonote::geAdd(
   ge_p1p1_to_p2(&result_p2, &sum);
 
   // Convert to bytes
-  ge_tobytes(reinterpret_cast<unsigned char*>(&result), &result_p2);
-
-  return cryptonote_utils::bintohex(result.data, CRYPTONOTE_POINT_SIZE);
+  ge_tobytes(out, &result_p2);
 }
 
-// Optimized geScalarmultBase with hex string inputs
-std::string HybridCryptonote::geScalarmultBase(
-  const std::string& secretKeyHex
-) {
-  if (!validateHexInput(secretKeyHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  crypto::SecretKey sec_key;
-  crypto::PublicKey result;
-
-  if (!cryptonote_utils::hextobin(secretKeyHex, sec_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in secretKey");
-  }
-
-  // Perform scalar multiplication with base point: result = sec_key * G
+// result = sec * G
+static void scalarmultBase(const uint8_t* sec, uint8_t* out) {
   ge_p3 point;
-  ge_scalarmult_base(&point, reinterpret_cast<const unsigned char*>(&sec_key));
-  
-  // Convert ge_p3 to bytes
-  ge_p3_tobytes(reinterpret_cast<unsigned char*>(&result), &point);
-
-  return cryptonote_utils::bintohex(result.data, CRYPTONOTE_KEY_SIZE);
+  ge_scalarmult_base(&point, sec);
+  ge_p3_tobytes(out, &point);
 }
 
-// Optimized geDoubleScalarmultBaseVartime with hex string inputs
-// Computes: c*P + r*G (where G is the base point)
-std::string HybridCryptonote::geDoubleScalarmultBaseVartime(
-  const std::string& cHex,
-  const std::string& PHex,
-  const std::string& rHex
-) {
-  if (!validateHexInput(cHex) || !validateHexInput(PHex) || !validateHexInput(rHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  crypto::SecretKey c_key, r_key;
-  crypto::PublicKey P_point, result;
-
-  if (!cryptonote_utils::hextobin(cHex, c_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in c");
-  }
-  if (!cryptonote_utils::hextobin(PHex, P_point.data, CRYPTONOTE_POINT_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in P");
-  }
-  if (!cryptonote_utils::hextobin(rHex, r_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in r");
-  }
-
+// result = c*P + r*G
+static void doubleScalarmultBase(const uint8_t* c, const uint8_t* P, const uint8_t* r, uint8_t* out) {
   // Convert P to ge_p3 format
   ge_p3 point_P;
-  if (ge_frombytes_vartime(&point_P, reinterpret_cast<const unsigned char*>(&P_point)) != 0) {
+  if (ge_frombytes_vartime(&point_P, P) != 0) {
     throw std::invalid_argument("Invalid point P (not on curve)");
   }
 
   // Perform double scalar multiplication: c*P + r*G
   ge_p2 result_p2;
-  ge_double_scalarmult_base_vartime(&result_p2, 
-                                     reinterpret_cast<const unsigned char*>(&c_key), 
-                                     &point_P, 
-                                     reinterpret_cast<const unsigned char*>(&r_key));
+  ge_double_scalarmult_base_vartime(&result_p2, c, &point_P, r);
 
   // Convert to bytes
-  ge_tobytes(reinterpret_cast<unsigned char*>(&result), &result_p2);
-
-  return cryptonote_utils::bintohex(result.data, CRYPTONOTE_POINT_SIZE);
+  ge_tobytes(out, &result_p2);
 }
 
-// Optimized geDoubleScalarmultPostcompVartime with hex string inputs
-// Computes: r*Pb + c*I (where Pb = hash_to_ec(P))
-std::string HybridCryptonote::geDoubleScalarmultPostcompVartime(
-  const std::string& rHex,
-  const std::string& PHex,
-  const std::string& cHex,
-  const std::string& IHex
-) {
-  if (!validateHexInput(rHex) || !validateHexInput(PHex) || !validateHexInput(cHex) || !validateHexInput(IHex)) {
-    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
-  }
-
-  crypto::SecretKey r_key, c_key;
-  crypto::PublicKey P_point, I_point, result;
-
-  if (!cryptonote_utils::hextobin(rHex, r_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in r");
-  }
-  if (!cryptonote_utils::hextobin(PHex, P_point.data, CRYPTONOTE_POINT_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in P");
-  }
-  if (!cryptonote_utils::hextobin(cHex, c_key.data, CRYPTONOTE_KEY_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in c");
-  }
-  if (!cryptonote_utils::hextobin(IHex, I_point.data, CRYPTONOTE_POINT_SIZE)) {
-    throw std::invalid_argument("Invalid hex string format in I");
-  }
+// result = r*Pb + c*I where Pb = hash_to_ec(P)
+static void doubleScalarmultPostcomp(const uint8_t* r, const uint8_t* P, const uint8_t* c, const uint8_t* I, uint8_t* out) {
+  crypto::PublicKey P_point;
+  std::memcpy(P_point.data, P, CRYPTONOTE_POINT_SIZE);
 
   // Hash P to elliptic curve point (Pb)
   crypto::KeyImage image;
@@ -309,7 +179,7 @@ std::string HybridCryptonote::geDoubleScalarmultPostcompVartime(
 
   // Convert I to ge_p3 format
   ge_p3 point_I;
-  if (ge_frombytes_vartime(&point_I, reinterpret_cast<const unsigned char*>(&I_point)) != 0) {
+  if (ge_frombytes_vartime(&point_I, I) != 0) {
     throw std::invalid_argument("Invalid point I (not on curve)");
   }
 
@@ -319,19 +189,373 @@ std::string HybridCryptonote::geDoubleScalarmultPostcompVartime(
 
   // Perform double scalar multiplication: r*Pb + c*I
   ge_p2 result_p2;
-  ge_double_scalarmult_precomp_vartime(&result_p2, 
-                                        reinterpret_cast<const unsigned char*>(&r_key), 
-                                        &point_I, 
-                                        reinterpret_cast<const unsigned char*>(&c_key), 
-                                        dsmp);
+  ge_double_scalarmult_precomp_vartime(&result_p2, r, &point_I, c, dsmp);
 
   // Convert to bytes
-  ge_tobytes(reinterpret_cast<unsigned char*>(&result), &result_p2);
+  ge_tobytes(out, &result_p2);
+}
+
+// Encode value as a Conceal varint into out (MAX_VARINT_SIZE bytes), returns the length
+static size_t varint(double value, uint8_t* out) {
+  // Validate input (must be non-negative integer)
+  if (value < 0) {
+    throw std::invalid_argument("Varint value must be non-negative");
+  }
+  
+  // Convert double to uint64_t (safe for JS Number.MAX_SAFE_INTEGER = 2^53-1)
+  uint64_t uint_value = static_cast<uint64_t>(value);
+  
+  // Check if conversion was lossy (value had fractional part or was too large)
+  if (static_cast<double>(uint_value) != value) {
+    throw std::invalid_argument("Varint value must be an integer within safe range");
+  }
+  
+  // Call optimized Conceal varint encoder (template function inlined)
+  uint8_t* ptr = out;
+  tools::write_varint(ptr, uint_value);
+  return static_cast<size_t>(ptr - out);
+}
+
+// Ring sizes are checked before anything is allocated for them
+static void checkRingSize(size_t count) {
+  if (count == 0) {
+    throw std::invalid_argument("Public keys array cannot be empty");
+  }
+  if (count > CRYPTONOTE_MAX_RING_SIZE) {
+    throw std::invalid_argument("Ring too large: " + std::to_string(count) + " members (maximum " +
+                                std::to_string(CRYPTONOTE_MAX_RING_SIZE) + ")");
+  }
+}
+
+// Sign with ring members packed as count consecutive 32-byte keys, writing
+// count consecutive 64-byte signatures. The pointer table lives on the stack,
+// like the rs_comm buffer inside generate_ring_signature itself; both are
+// bounded by checkRingSize.
+static void ringSignature(const uint8_t* prefixHash, const uint8_t* keyImage,
+                          const uint8_t* publicKeys, size_t count,
+                          const uint8_t* secretKey, double secretIndex,
+                          uint8_t* signatures) {
+  checkRingSize(count);
+  if (secretIndex < 0 || static_cast<size_t>(secretIndex) >= count) {
+    throw std::invalid_argument("Secret index out of range");
+  }
+
+  crypto::Hash prefix_hash;
+  crypto::KeyImage key_image;
+  crypto::SecretKey secret_key;
+  std::memcpy(prefix_hash.data, prefixHash, 32);
+  std::memcpy(key_image.data, keyImage, 32);
+  std::memcpy(secret_key.data, secretKey, 32);
+
+  // PublicKey and Signature are plain byte arrays, so the packed buffers can be used in place
+  auto** public_key_ptrs = static_cast<const crypto::PublicKey**>(alloca(count * sizeof(crypto::PublicKey*)));
+  for (size_t i = 0; i < count; ++i) {
+    public_key_ptrs[i] = reinterpret_cast<const crypto::PublicKey*>(publicKeys + i * CRYPTONOTE_KEY_SIZE);
+  }
+
+  crypto::crypto_ops::generate_ring_signature(
+    prefix_hash,
+    key_image,
+    public_key_ptrs,
+    count,
+    secret_key,
+    static_cast<size_t>(secretIndex),
+    reinterpret_cast<crypto::Signature*>(signatures)
+  );
+  sodium_memzero(secret_key.data, sizeof(secret_key.data));
+}
+
+// Parse a Base58 address into its varint prefix and the two public keys.
+// `data` is scratch space so batch validation reuses one buffer.
+static bool parseAddress(const std::string& address, std::vector<uint8_t>& data,
+                         uint64_t& prefix, uint8_t* spend, uint8_t* view) {
+  if (!Base58::decode(address, data) || data.size() <= CRYPTONOTE_ADDRESS_CHECKSUM_SIZE) {
+    return false;
+  }
+
+  size_t bodySize = data.size() - CRYPTONOTE_ADDRESS_CHECKSUM_SIZE;
+  uint8_t hash[32];
+  cn_fast_hash(data.data(), bodySize, reinterpret_cast<char*>(hash));
+  if (std::memcmp(hash, data.data() + bodySize, CRYPTONOTE_ADDRESS_CHECKSUM_SIZE) != 0) {
+    return false;
+  }
+
+  const uint8_t* it = data.data();
+  const uint8_t* end = data.data() + bodySize;
+  int read = tools::read_varint(it, end, prefix);
+  if (read <= 0 || bodySize - static_cast<size_t>(read) != 2 * CRYPTONOTE_KEY_SIZE) {
+    return false;
+  }
+  std::memcpy(spend, it, CRYPTONOTE_KEY_SIZE);
+  std::memcpy(view, it + CRYPTONOTE_KEY_SIZE, CRYPTONOTE_KEY_SIZE);
+
+  // Both keys must be valid curve points
+  ge_p3 point;
+  return ge_frombytes_vartime(&point, spend) == 0 && ge_frombytes_vartime(&point, view) == 0;
+}
+
+// Per-element status codes of the batch varint calls
+constexpr uint8_t VARINT_OK = 0;
+constexpr uint8_t VARINT_OVERFLOW = 1;
+constexpr uint8_t VARINT_NON_CANONICAL = 2;
+constexpr uint8_t VARINT_TRUNCATED = 3;
+constexpr uint8_t VARINT_NOT_AN_INTEGER = 4;
+
+static size_t varintSize(uint64_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+// Validate ring-offset arguments: Float64Array values split into groups by a
+// Uint32Array of ring sizes. Returns the number of groups.
+static size_t ringGroups(const std::shared_ptr<ArrayBuffer>& values, const std::shared_ptr<ArrayBuffer>& ringSizes) {
+  if (!values || values->size() % sizeof(double) != 0) {
+    throw std::invalid_argument("Offsets must be a Float64Array buffer");
+  }
+  if (!ringSizes || ringSizes->size() % sizeof(uint32_t) != 0) {
+    throw std::invalid_argument("Ring sizes must be a Uint32Array buffer");
+  }
+  size_t groups = ringSizes->size() / sizeof(uint32_t);
+  size_t total = 0;
+  for (size_t g = 0; g < groups; ++g) {
+    uint32_t size;
+    std::memcpy(&size, ringSizes->data() + g * sizeof(uint32_t), sizeof(uint32_t));
+    total += size;
+  }
+  if (total != values->size() / sizeof(double)) {
+    throw std::invalid_argument("Ring sizes must add up to the number of offsets");
+  }
+  return groups;
+}
+
+static uint64_t offsetValue(double value, size_t index) {
+  if (!(value >= 0) || value > 9007199254740991.0 || std::floor(value) != value) {
+    throw std::invalid_argument("Invalid offset at index " + std::to_string(index) + ": must be a non-negative safe integer");
+  }
+  return static_cast<uint64_t>(value);
+}
+
+// ---------------------------------------------------------------------------
+// Argument helpers
+// ---------------------------------------------------------------------------
+
+// Decode a 64-char hex argument (length already validated) into out
+static void decodeKeyHex(const std::string& hex, uint8_t* out, const char* name) {
+  if (!cryptonote_utils::hextobin(hex, out, CRYPTONOTE_KEY_SIZE)) {
+    throw std::invalid_argument(std::string("Invalid hex string format in ") + name);
+  }
+}
+
+// Borrow the bytes of a 32-byte ArrayBuffer argument
+static const uint8_t* keyBytes(const std::shared_ptr<ArrayBuffer>& buffer, const char* name) {
+  if (!buffer || buffer->size() != CRYPTONOTE_KEY_SIZE) {
+    throw std::invalid_argument(std::string("Invalid ") + name + ": must be 32 bytes");
+  }
+  return static_cast<const uint8_t*>(buffer->data());
+}
+
+static std::string keyHex(const uint8_t* data) {
+  return cryptonote_utils::bintohex(data, CRYPTONOTE_KEY_SIZE);
+}
+
+static const HybridSecretKeyHandle& secretKeyHandle(const std::shared_ptr<HybridSecretKeyHandleSpec>& handle) {
+  auto* native = dynamic_cast<const HybridSecretKeyHandle*>(handle.get());
+  if (native == nullptr) {
+    throw std::invalid_argument("Invalid secret key handle");
+  }
+  return *native;
+}
+
+// Run fn(secretKeyBytes) for a 32-byte buffer or a SecretKeyHandle argument
+template <typename Fn>
+static auto withSecretKey(const SecretKeyBinArg& secretKey, const char* name, Fn&& fn) {
+  if (auto* handle = std::get_if<std::shared_ptr<HybridSecretKeyHandleSpec>>(&secretKey)) {
+    return secretKeyHandle(*handle).use(fn);
+  }
+  return fn(keyBytes(std::get<std::shared_ptr<ArrayBuffer>>(secretKey), name));
+}
+
+// Run fn(secretKeyBytes) for a 64-char hex secret key; the decoded copy is wiped afterwards
+template <typename Fn>
+static auto withSecretKeyHex(const std::string& hex, const char* name, Fn&& fn) {
+  if (!cryptonote_utils::isValidHexSize(hex.length(), CRYPTONOTE_KEY_SIZE)) {
+    throw std::invalid_argument(std::string("Invalid ") + name + ": must be 64 characters (32 bytes)");
+  }
+  struct ScopedKey {
+    uint8_t data[CRYPTONOTE_KEY_SIZE];
+    ~ScopedKey() { sodium_memzero(data, sizeof(data)); }
+  } sec;
+  decodeKeyHex(hex, sec.data, name);
+  return fn(static_cast<const uint8_t*>(sec.data));
+}
+
+// Same for a hex string or a SecretKeyHandle argument
+template <typename Fn>
+static auto withSecretKey(const SecretKeyHexArg& secretKeyHex, const char* name, Fn&& fn) {
+  if (auto* handle = std::get_if<std::shared_ptr<HybridSecretKeyHandleSpec>>(&secretKeyHex)) {
+    return secretKeyHandle(*handle).use(fn);
+  }
+  return withSecretKeyHex(std::get<std::string>(secretKeyHex), name, fn);
+}
+
+// Async arguments: buffers are retained like any other input, handles are shared
+static SecretKeyBinArg retainForAsync(const SecretKeyBinArg& secretKey) {
+  if (auto* buffer = std::get_if<std::shared_ptr<ArrayBuffer>>(&secretKey)) {
+    return retainForAsync(*buffer);
+  }
+  return secretKey;
+}
+
+// Hex secret decoded on the JS thread, so no copy of the string reaches the
+// worker; the bytes are wiped when the task releases them. A decoding error is
+// kept and rethrown where the key is used, so the promise rejects as before.
+struct DecodedSecretKey {
+  uint8_t data[CRYPTONOTE_KEY_SIZE];
+  std::exception_ptr error;
+  ~DecodedSecretKey() { sodium_memzero(data, sizeof(data)); }
+};
+using AsyncSecretKeyArg = std::variant<std::shared_ptr<DecodedSecretKey>, std::shared_ptr<HybridSecretKeyHandleSpec>>;
+
+static AsyncSecretKeyArg retainForAsync(const SecretKeyHexArg& secretKeyHex) {
+  if (auto* handle = std::get_if<std::shared_ptr<HybridSecretKeyHandleSpec>>(&secretKeyHex)) {
+    return *handle;
+  }
+  auto key = std::make_shared<DecodedSecretKey>();
+  try {
+    withSecretKeyHex(std::get<std::string>(secretKeyHex), "secret key", [&](const uint8_t* sec) {
+      std::memcpy(key->data, sec, CRYPTONOTE_KEY_SIZE);
+    });
+  } catch (...) {
+    key->error = std::current_exception();
+  }
+  return key;
+}
+
+template <typename Fn>
+static auto withSecretKey(const AsyncSecretKeyArg& secretKey, const char* /* name */, Fn&& fn) {
+  if (auto* handle = std::get_if<std::shared_ptr<HybridSecretKeyHandleSpec>>(&secretKey)) {
+    return secretKeyHandle(*handle).use(fn);
+  }
+  const DecodedSecretKey& key = *std::get<std::shared_ptr<DecodedSecretKey>>(secretKey);
+  if (key.error) std::rethrow_exception(key.error);
+  return fn(static_cast<const uint8_t*>(key.data));
+}
+
+// ---------------------------------------------------------------------------
+// Hex entry points (thin wrappers over the primitives above)
+// ---------------------------------------------------------------------------
+
+std::string HybridCryptonote::generateKeyDerivation(
+  const std::string& publicKeyHex,
+  const SecretKeyHexArg& secretKeyHex
+) {
+  if (!validateHexInput(publicKeyHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t pub[CRYPTONOTE_KEY_SIZE], out[CRYPTONOTE_DERIVATION_SIZE];
+  decodeKeyHex(publicKeyHex, pub, "publicKey");
+  withSecretKey(secretKeyHex, "secretKey", [&](const uint8_t* sec) { keyDerivation(pub, sec, out); });
+  return keyHex(out);
+}
+
+std::string HybridCryptonote::derivePublicKey(
+  const std::string& derivationHex, 
+  double outputIndex, 
+  const std::string& publicKeyHex
+) {
+  if (!validateHexInput(derivationHex) || !validateHexInput(publicKeyHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t deriv[CRYPTONOTE_DERIVATION_SIZE], pub[CRYPTONOTE_KEY_SIZE], out[CRYPTONOTE_KEY_SIZE];
+  decodeKeyHex(derivationHex, deriv, "derivation");
+  decodeKeyHex(publicKeyHex, pub, "publicKey");
+  derivedPublicKey(deriv, outputIndex, pub, out);
+  return keyHex(out);
+}
+
+std::string HybridCryptonote::geScalarmult(
+  const std::string& publicKeyHex,
+  const SecretKeyHexArg& secretKeyHex
+) {
+  if (!validateHexInput(publicKeyHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t pub[CRYPTONOTE_KEY_SIZE], out[CRYPTONOTE_POINT_SIZE];
+  decodeKeyHex(publicKeyHex, pub, "publicKey");
+  withSecretKey(secretKeyHex, "secretKey", [&](const uint8_t* sec) { scalarmult(pub, sec, out); });
+  return keyHex(out);
+}
+
+std::string HybridCryptonote::geAdd(
+  const std::string& point1Hex,
+  const std::string& point2Hex
+) {
+  if (!validateHexInput(point1Hex) || !validateHexInput(point2Hex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t p1[CRYPTONOTE_POINT_SIZE], p2[CRYPTONOTE_POINT_SIZE], out[CRYPTONOTE_POINT_SIZE];
+  decodeKeyHex(point1Hex, p1, "point1");
+  decodeKeyHex(point2Hex, p2, "point2");
+  pointAdd(p1, p2, out);
+  return keyHex(out);
+}
+
+std::string HybridCryptonote::geScalarmultBase(
+  const SecretKeyHexArg& secretKeyHex
+) {
+  uint8_t out[CRYPTONOTE_KEY_SIZE];
+  withSecretKey(secretKeyHex, "secretKey", [&](const uint8_t* sec) { scalarmultBase(sec, out); });
+  return keyHex(out);
+}
+
+// Computes: c*P + r*G (where G is the base point)
+std::string HybridCryptonote::geDoubleScalarmultBaseVartime(
+  const std::string& cHex,
+  const std::string& PHex,
+  const std::string& rHex
+) {
+  if (!validateHexInput(cHex) || !validateHexInput(PHex) || !validateHexInput(rHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t c[CRYPTONOTE_KEY_SIZE], P[CRYPTONOTE_POINT_SIZE], r[CRYPTONOTE_KEY_SIZE], out[CRYPTONOTE_POINT_SIZE];
+  decodeKeyHex(cHex, c, "c");
+  decodeKeyHex(PHex, P, "P");
+  decodeKeyHex(rHex, r, "r");
+  doubleScalarmultBase(c, P, r, out);
+  return keyHex(out);
+}
+
+// Computes: r*Pb + c*I (where Pb = hash_to_ec(P))
+std::string HybridCryptonote::geDoubleScalarmultPostcompVartime(
+  const std::string& rHex,
+  const std::string& PHex,
+  const std::string& cHex,
+  const std::string& IHex
+) {
+  if (!validateHexInput(rHex) || !validateHexInput(PHex) || !validateHexInput(cHex) || !validateHexInput(IHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
 
-  return cryptonote_utils::bintohex(result.data, CRYPTONOTE_POINT_SIZE);
+  uint8_t r[CRYPTONOTE_KEY_SIZE], P[CRYPTONOTE_POINT_SIZE], c[CRYPTONOTE_KEY_SIZE], I[CRYPTONOTE_POINT_SIZE];
+  uint8_t out[CRYPTONOTE_POINT_SIZE];
+  decodeKeyHex(rHex, r, "r");
+  decodeKeyHex(PHex, P, "P");
+  decodeKeyHex(cHex, c, "c");
+  decodeKeyHex(IHex, I, "I");
+  doubleScalarmultPostcomp(r, P, c, I, out);
+  return keyHex(out);
 }
 
-// Optimized cnFastHash (Keccak-256) with hex string input
+// Keccak-256 with hex string input
 // This is one of the most frequently called functions - used in every transaction!
 std::string HybridCryptonote::cnFastHash(const std::string& inputHex) {
   // Validate hex input (must be even length)
@@ -347,51 +571,126 @@ std::string HybridCryptonote::cnFastHash(const std::string& inputHex) {
     throw std::invalid_argument("Invalid hex string format");
   }
 
-  // Allocate 32-byte buffer for hash output (Keccak-256)
   uint8_t hash[32];
-
-  // Call native Keccak-256 (cn_fast_hash from crypto-ops)
   cn_fast_hash(data.data(), dataLen, reinterpret_cast<char*>(hash));
-
-  // Convert result to hex and return
-  return cryptonote_utils::bintohex(hash, 32);
+  return keyHex(hash);
 }
 
-// Optimized encodeVarint using native Conceal varint implementation
+// Varint encoding with hex output
 std::string HybridCryptonote::encodeVarint(double value) {
-  // Validate input (must be non-negative integer)
-  if (value < 0) {
-    throw std::invalid_argument("Varint value must be non-negative");
-  }
-  
-  // Convert double to uint64_t (safe for JS Number.MAX_SAFE_INTEGER = 2^53-1)
-  uint64_t uint_value = static_cast<uint64_t>(value);
-  
-  // Check if conversion was lossy (value had fractional part or was too large)
-  if (static_cast<double>(uint_value) != value) {
-    throw std::invalid_argument("Varint value must be an integer within safe range");
-  }
-  
-  // Use stack buffer with constexpr size (max 10 bytes for 64-bit varint)
   uint8_t buffer[MAX_VARINT_SIZE];
-  uint8_t* ptr = buffer;
-  
-  // Call optimized Conceal varint encoder (template function inlined)
-  tools::write_varint(ptr, uint_value);
-  
-  // Calculate actual encoded length
-  size_t length = ptr - buffer;
-  
-  // Convert to hex and return
+  size_t length = varint(value, buffer);
   return cryptonote_utils::bintohex(buffer, length);
 }
 
-// Optimized generateRingSignature -
-std::vector<std::string> HybridCryptonote::generateRingSignature(
+// ---------------------------------------------------------------------------
+// Binary entry points: 32-byte ArrayBuffers in, 32-byte ArrayBuffer out
+// ---------------------------------------------------------------------------
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::generateKeyDerivationBin(
+  const std::shared_ptr<ArrayBuffer>& publicKey,
+  const SecretKeyBinArg& secretKey
+) {
+  const uint8_t* pub = keyBytes(publicKey, "publicKey");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_DERIVATION_SIZE);
+  withSecretKey(secretKey, "secretKey", [&](const uint8_t* sec) { keyDerivation(pub, sec, result->data()); });
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::derivePublicKeyBin(
+  const std::shared_ptr<ArrayBuffer>& derivation,
+  double outputIndex,
+  const std::shared_ptr<ArrayBuffer>& publicKey
+) {
+  const uint8_t* deriv = keyBytes(derivation, "derivation");
+  const uint8_t* pub = keyBytes(publicKey, "publicKey");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_KEY_SIZE);
+  derivedPublicKey(deriv, outputIndex, pub, result->data());
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::geScalarmultBin(
+  const std::shared_ptr<ArrayBuffer>& publicKey,
+  const SecretKeyBinArg& secretKey
+) {
+  const uint8_t* pub = keyBytes(publicKey, "publicKey");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_POINT_SIZE);
+  withSecretKey(secretKey, "secretKey", [&](const uint8_t* sec) { scalarmult(pub, sec, result->data()); });
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::geAddBin(
+  const std::shared_ptr<ArrayBuffer>& point1,
+  const std::shared_ptr<ArrayBuffer>& point2
+) {
+  const uint8_t* p1 = keyBytes(point1, "point1");
+  const uint8_t* p2 = keyBytes(point2, "point2");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_POINT_SIZE);
+  pointAdd(p1, p2, result->data());
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::geScalarmultBaseBin(
+  const SecretKeyBinArg& secretKey
+) {
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_KEY_SIZE);
+  withSecretKey(secretKey, "secretKey", [&](const uint8_t* sec) { scalarmultBase(sec, result->data()); });
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::geDoubleScalarmultBaseVartimeBin(
+  const std::shared_ptr<ArrayBuffer>& c,
+  const std::shared_ptr<ArrayBuffer>& P,
+  const std::shared_ptr<ArrayBuffer>& r
+) {
+  const uint8_t* cBytes = keyBytes(c, "c");
+  const uint8_t* PBytes = keyBytes(P, "P");
+  const uint8_t* rBytes = keyBytes(r, "r");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_POINT_SIZE);
+  doubleScalarmultBase(cBytes, PBytes, rBytes, result->data());
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::geDoubleScalarmultPostcompVartimeBin(
+  const std::shared_ptr<ArrayBuffer>& r,
+  const std::shared_ptr<ArrayBuffer>& P,
+  const std::shared_ptr<ArrayBuffer>& c,
+  const std::shared_ptr<ArrayBuffer>& I
+) {
+  const uint8_t* rBytes = keyBytes(r, "r");
+  const uint8_t* PBytes = keyBytes(P, "P");
+  const uint8_t* cBytes = keyBytes(c, "c");
+  const uint8_t* IBytes = keyBytes(I, "I");
+  auto result = ArrayBuffer::allocate(CRYPTONOTE_POINT_SIZE);
+  doubleScalarmultPostcomp(rBytes, PBytes, cBytes, IBytes, result->data());
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::cnFastHashBin(const std::shared_ptr<ArrayBuffer>& input) {
+  if (!input) {
+    throw std::invalid_argument("Input buffer must not be null");
+  }
+  auto result = ArrayBuffer::allocate(32);
+  cn_fast_hash(input->data(), input->size(), reinterpret_cast<char*>(result->data()));
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::encodeVarintBin(double value) {
+  uint8_t buffer[MAX_VARINT_SIZE];
+  size_t length = varint(value, buffer);
+  auto result = ArrayBuffer::allocate(length);
+  std::memcpy(result->data(), buffer, length);
+  return result;
+}
+
+// Ring signature with hex string inputs, one string per ring member
+// (SecretKeyArg: SecretKeyHexArg, or AsyncSecretKeyArg on a worker thread)
+template <typename SecretKeyArg>
+static std::vector<std::string> ringSignatureHex(
   const std::string& prefixHashHex,
   const std::string& keyImageHex,
   const std::vector<std::string>& publicKeysHex,
-  const std::string& secretKeyHex,
+  const SecretKeyArg& secretKeyHex,
   double secretIndex
 ) {
   // Validate inputs
@@ -401,76 +700,417 @@ std::vector<std::string> HybridCryptonote::generateRingSignature(
   if (keyImageHex.length() != 64) {
     throw std::invalid_argument("Invalid key image: must be 64 characters (32 bytes)");
   }
-  if (secretKeyHex.length() != 64) {
-    throw std::invalid_argument("Invalid secret key: must be 64 characters (32 bytes)");
-  }
-  if (publicKeysHex.empty()) {
-    throw std::invalid_argument("Public keys array cannot be empty");
-  }
   
-  size_t sec_idx = static_cast<size_t>(secretIndex);
-  if (sec_idx >= publicKeysHex.size()) {
-    throw std::invalid_argument("Secret index out of range");
-  }
-  
-  // Parse prefix hash (32 bytes)
-  crypto::Hash prefix_hash;
-  if (!cryptonote_utils::hextobin(prefixHashHex, prefix_hash.data, 32)) {
+  uint8_t prefix_hash[32], key_image[32];
+  if (!cryptonote_utils::hextobin(prefixHashHex, prefix_hash, 32)) {
     throw std::invalid_argument("Invalid hex format in prefix hash");
   }
-  
-  // Parse key image (32 bytes)
-  crypto::KeyImage key_image;
-  if (!cryptonote_utils::hextobin(keyImageHex, key_image.data, 32)) {
+  if (!cryptonote_utils::hextobin(keyImageHex, key_image, 32)) {
     throw std::invalid_argument("Invalid hex format in key image");
   }
   
-  // Parse secret key (32 bytes)
-  crypto::SecretKey secret_key;
-  if (!cryptonote_utils::hextobin(secretKeyHex, secret_key.data, 32)) {
-    throw std::invalid_argument("Invalid hex format in secret key");
-  }
-  
-  // Parse all public keys and create pointer array
+  // Pack all public keys into one buffer
   size_t pubs_count = publicKeysHex.size();
-  std::vector<crypto::PublicKey> public_keys(pubs_count);
-  std::vector<const crypto::PublicKey*> public_key_ptrs(pubs_count);
+  checkRingSize(pubs_count);
+  std::vector<uint8_t> public_keys(pubs_count * CRYPTONOTE_KEY_SIZE);
   
   for (size_t i = 0; i < pubs_count; ++i) {
     if (publicKeysHex[i].length() != 64) {
       throw std::invalid_argument("Invalid public key at index " + std::to_string(i) + ": must be 64 characters");
     }
-    if (!cryptonote_utils::hextobin(publicKeysHex[i], public_keys[i].data, 32)) {
+    if (!cryptonote_utils::hextobin(publicKeysHex[i], public_keys.data() + i * CRYPTONOTE_KEY_SIZE, 32)) {
       throw std::invalid_argument("Invalid hex format in public key at index " + std::to_string(i));
     }
-    public_key_ptrs[i] = &public_keys[i];
   }
   
-  // Allocate signatures array (each signature is 64 bytes)
-  std::vector<crypto::Signature> signatures(pubs_count);
-  
-  // Call the native C++ ring signature generation
-  // This is the magic that gives us 100x speedup!
-  crypto::crypto_ops::generate_ring_signature(
-    prefix_hash,
-    key_image,
-    public_key_ptrs.data(),
-    pubs_count,
-    secret_key,
-    sec_idx,
-    signatures.data()
-  );
+  std::vector<uint8_t> signatures(pubs_count * CRYPTONOTE_SIGNATURE_SIZE);
+  withSecretKey(secretKeyHex, "secret key", [&](const uint8_t* sec) {
+    ringSignature(prefix_hash, key_image, public_keys.data(), pubs_count, sec, secretIndex, signatures.data());
+  });
   
-  // Convert signatures to hex strings
+  // Convert signatures to hex strings (128 hex characters each)
   std::vector<std::string> result;
   result.reserve(pubs_count);
   
   for (size_t i = 0; i < pubs_count; ++i) {
-    // Each signature is 64 bytes (128 hex characters)
-    result.push_back(cryptonote_utils::bintohex(reinterpret_cast<const uint8_t*>(&signatures[i]), 64));
+    result.push_back(cryptonote_utils::bintohex(signatures.data() + i * CRYPTONOTE_SIGNATURE_SIZE, CRYPTONOTE_SIGNATURE_SIZE));
   }
   
   return result;
 }
 
+std::vector<std::string> HybridCryptonote::generateRingSignature(
+  const std::string& prefixHashHex,
+  const std::string& keyImageHex,
+  const std::vector<std::string>& publicKeysHex,
+  const SecretKeyHexArg& secretKeyHex,
+  double secretIndex
+) {
+  return ringSignatureHex(prefixHashHex, keyImageHex, publicKeysHex, secretKeyHex, secretIndex);
+}
+
+// Ring signature over packed buffers: n*32-byte keys in, n*64-byte signatures out
+std::shared_ptr<ArrayBuffer> HybridCryptonote::generateRingSignatureBin(
+  const std::shared_ptr<ArrayBuffer>& prefixHash,
+  const std::shared_ptr<ArrayBuffer>& keyImage,
+  const std::shared_ptr<ArrayBuffer>& publicKeys,
+  const SecretKeyBinArg& secretKey,
+  double secretIndex
+) {
+  const uint8_t* prefix = keyBytes(prefixHash, "prefix hash");
+  const uint8_t* image = keyBytes(keyImage, "key image");
+  if (!publicKeys || publicKeys->size() % CRYPTONOTE_KEY_SIZE != 0) {
+    throw std::invalid_argument("Invalid public keys: size must be a multiple of 32 bytes");
+  }
+
+  size_t pubs_count = publicKeys->size() / CRYPTONOTE_KEY_SIZE;
+  checkRingSize(pubs_count);
+  auto result = ArrayBuffer::allocate(pubs_count * CRYPTONOTE_SIGNATURE_SIZE);
+  withSecretKey(secretKey, "secret key", [&](const uint8_t* sec) {
+    ringSignature(prefix, image, publicKeys->data(), pubs_count, sec, secretIndex, result->data());
+  });
+  return result;
+}
+
+// ---------------------------------------------------------------------------
+// Batch varints
+// ---------------------------------------------------------------------------
+
+VarintBatchResult HybridCryptonote::encodeVarints(
+  const std::shared_ptr<ArrayBuffer>& values,
+  const std::optional<bool>& bigint
+) {
+  if (!values || values->size() % sizeof(uint64_t) != 0) {
+    throw std::invalid_argument("Values must be a Float64Array or BigUint64Array buffer");
+  }
+  const bool isBigint = bigint.value_or(false);
+  const size_t count = values->size() / sizeof(uint64_t);
+  const uint8_t* in = values->data();
+
+  auto status = ArrayBuffer::allocate(count);
+  uint8_t* statusData = status->data();
+
+  // Pass 1: validate and size, so the output is allocated exactly once
+  std::vector<uint64_t> converted(count);
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t value;
+    statusData[i] = VARINT_OK;
+    if (isBigint) {
+      std::memcpy(&value, in + i * sizeof(uint64_t), sizeof(uint64_t));
+    } else {
+      double number;
+      std::memcpy(&number, in + i * sizeof(double), sizeof(double));
+      if (!(number >= 0) || std::floor(number) != number) {
+        statusData[i] = VARINT_NOT_AN_INTEGER;
+        continue;
+      }
+      if (number > 9007199254740991.0) {
+        statusData[i] = VARINT_OVERFLOW;
+        continue;
+      }
+      value = static_cast<uint64_t>(number);
+    }
+    converted[i] = value;
+    total += varintSize(value);
+  }
+
+  // Pass 2: write; rejected elements contribute no bytes
+  auto data = ArrayBuffer::allocate(total);
+  uint8_t* out = data->data();
+  for (size_t i = 0; i < count; ++i) {
+    if (statusData[i] == VARINT_OK) tools::write_varint(out, converted[i]);
+  }
+  return VarintBatchResult(data, status);
+}
+
+VarintBatchResult HybridCryptonote::decodeVarints(const std::shared_ptr<ArrayBuffer>& data) {
+  if (!data) {
+    throw std::invalid_argument("Varint buffer must not be null");
+  }
+  const uint8_t* it = data->data();
+  const uint8_t* end = it + data->size();
+
+  // Every element ends on a byte without the continuation bit (or at a truncated tail)
+  size_t count = 0;
+  for (const uint8_t* p = it; p != end; ++p) count += (*p & 0x80) == 0;
+  if (it != end && (end[-1] & 0x80) != 0) count++;
+
+  auto values = ArrayBuffer::allocate(count * sizeof(uint64_t));
+  auto status = ArrayBuffer::allocate(count);
+  uint8_t* valueData = values->data();
+  uint8_t* statusData = status->data();
+
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t value = 0;
+    int read = tools::read_varint(it, end, value);
+    if (read > 0 && (it[-1] & 0x80) == 0) {
+      statusData[i] = VARINT_OK;
+    } else {
+      statusData[i] = read == -1 ? VARINT_OVERFLOW : read == -2 ? VARINT_NON_CANONICAL : VARINT_TRUNCATED;
+      value = 0;
+      // Resynchronise on the element's final byte
+      while (it != end && (it[-1] & 0x80) != 0) ++it;
+    }
+    std::memcpy(valueData + i * sizeof(uint64_t), &value, sizeof(uint64_t));
+  }
+  return VarintBatchResult(values, status);
+}
+
+// ---------------------------------------------------------------------------
+// Ring member offsets
+// ---------------------------------------------------------------------------
+
+RingOffsetsResult HybridCryptonote::absoluteToRelativeOffsets(
+  const std::shared_ptr<ArrayBuffer>& absolute,
+  const std::shared_ptr<ArrayBuffer>& ringSizes
+) {
+  size_t groups = ringGroups(absolute, ringSizes);
+  size_t count = absolute->size() / sizeof(double);
+
+  // Sort each ring and take deltas (first entry stays absolute)
+  std::vector<uint64_t> relative(count);
+  for (size_t i = 0; i < count; ++i) {
+    double value;
+    std::memcpy(&value, absolute->data() + i * sizeof(double), sizeof(double));
+    relative[i] = offsetValue(value, i);
+  }
+
+  size_t packedSize = 0;
+  size_t start = 0;
+  for (size_t g = 0; g < groups; ++g) {
+    uint32_t size;
+    std::memcpy(&size, ringSizes->data() + g * sizeof(uint32_t), sizeof(uint32_t));
+    auto first = relative.begin() + static_cast<ptrdiff_t>(start);
+    std::sort(first, first + size);
+    for (size_t i = start + size; i-- > start + 1;) {
+      relative[i] -= relative[i - 1];
+      // Nodes reject rings that reference the same output twice
+      if (relative[i] == 0) {
+        throw std::invalid_argument("Duplicate offset in ring " + std::to_string(g));
+      }
+    }
+
+    packedSize += varintSize(size);
+    for (size_t i = start; i < start + size; ++i) packedSize += varintSize(relative[i]);
+    start += size;
+  }
+
+  auto relativeBuffer = ArrayBuffer::allocate(count * sizeof(double));
+  for (size_t i = 0; i < count; ++i) {
+    double value = static_cast<double>(relative[i]);
+    std::memcpy(relativeBuffer->data() + i * sizeof(double), &value, sizeof(double));
+  }
+
+  // Per ring: varint(count) || varint(offset)..., i.e. a key input's wire format
+  auto packed = ArrayBuffer::allocate(packedSize);
+  auto packedOffsets = ArrayBuffer::allocate((groups + 1) * sizeof(uint32_t));
+  uint8_t* out = packed->data();
+  start = 0;
+  for (size_t g = 0; g <= groups; ++g) {
+    uint32_t offset = static_cast<uint32_t>(out - packed->data());
+    std::memcpy(packedOffsets->data() + g * sizeof(uint32_t), &offset, sizeof(uint32_t));
+    if (g == groups) break;
+
+    uint32_t size;
+    std::memcpy(&size, ringSizes->data() + g * sizeof(uint32_t), sizeof(uint32_t));
+    tools::write_varint(out, static_cast<uint64_t>(size));
+    for (size_t i = start; i < start + size; ++i) tools::write_varint(out, relative[i]);
+    start += size;
+  }
+
+  return RingOffsetsResult(relativeBuffer, packed, packedOffsets);
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::relativeToAbsoluteOffsets(
+  const std::shared_ptr<ArrayBuffer>& relative,
+  const std::shared_ptr<ArrayBuffer>& ringSizes
+) {
+  size_t groups = ringGroups(relative, ringSizes);
+  size_t count = relative->size() / sizeof(double);
+  auto result = ArrayBuffer::allocate(count * sizeof(double));
+
+  // Prefix sum within each ring
+  size_t index = 0;
+  for (size_t g = 0; g < groups; ++g) {
+    uint32_t size;
+    std::memcpy(&size, ringSizes->data() + g * sizeof(uint32_t), sizeof(uint32_t));
+    uint64_t sum = 0;
+    for (uint32_t k = 0; k < size; ++k, ++index) {
+      double value;
+      std::memcpy(&value, relative->data() + index * sizeof(double), sizeof(double));
+      sum += offsetValue(value, index);
+      if (sum > 9007199254740991ULL) {
+        throw std::invalid_argument("Absolute offset at index " + std::to_string(index) + " exceeds safe integer range");
+      }
+      double absolute = static_cast<double>(sum);
+      std::memcpy(result->data() + index * sizeof(double), &absolute, sizeof(double));
+    }
+  }
+  return result;
+}
+
+// ---------------------------------------------------------------------------
+// Addresses: Base58(varint(prefix) || spend || view || cn_fast_hash(...)[0..4])
+// ---------------------------------------------------------------------------
+
+std::string HybridCryptonote::encodeAddress(
+  double prefix,
+  const std::string& spendPublicKeyHex,
+  const std::string& viewPublicKeyHex
+) {
+  if (!validateHexInput(spendPublicKeyHex) || !validateHexInput(viewPublicKeyHex)) {
+    throw std::invalid_argument("Invalid hex string: must be 64 characters (32 bytes)");
+  }
+
+  uint8_t data[MAX_VARINT_SIZE + 2 * CRYPTONOTE_KEY_SIZE + CRYPTONOTE_ADDRESS_CHECKSUM_SIZE];
+  size_t length = varint(prefix, data);
+  decodeKeyHex(spendPublicKeyHex, data + length, "spendPublicKey");
+  decodeKeyHex(viewPublicKeyHex, data + length + CRYPTONOTE_KEY_SIZE, "viewPublicKey");
+  length += 2 * CRYPTONOTE_KEY_SIZE;
+
+  uint8_t hash[32];
+  cn_fast_hash(data, length, reinterpret_cast<char*>(hash));
+  std::memcpy(data + length, hash, CRYPTONOTE_ADDRESS_CHECKSUM_SIZE);
+  length += CRYPTONOTE_ADDRESS_CHECKSUM_SIZE;
+
+  return Base58::encode(data, length);
+}
+
+DecodedAddress HybridCryptonote::decodeAddress(const std::string& address) {
+  std::vector<uint8_t> data;
+  uint64_t prefix;
+  uint8_t spend[CRYPTONOTE_KEY_SIZE], view[CRYPTONOTE_KEY_SIZE];
+  if (!parseAddress(address, data, prefix, spend, view)) {
+    throw std::invalid_argument("Invalid address");
+  }
+  // Prefixes are returned as JS numbers
+  if (prefix > (uint64_t(1) << 53) - 1) {
+    throw std::invalid_argument("Address prefix exceeds safe integer range");
+  }
+  return DecodedAddress(static_cast<double>(prefix), keyHex(spend), keyHex(view));
+}
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::validateAddresses(
+  const std::vector<std::string>& addresses,
+  double prefix
+) {
+  auto result = ArrayBuffer::allocate(addresses.size());
+  uint8_t* status = result->data();
+
+  std::vector<uint8_t> data;
+  data.reserve(MAX_VARINT_SIZE + 2 * CRYPTONOTE_KEY_SIZE + CRYPTONOTE_ADDRESS_CHECKSUM_SIZE);
+  uint8_t spend[CRYPTONOTE_KEY_SIZE], view[CRYPTONOTE_KEY_SIZE];
+  for (size_t i = 0; i < addresses.size(); ++i) {
+    uint64_t decodedPrefix;
+    status[i] = parseAddress(addresses[i], data, decodedPrefix, spend, view) &&
+                static_cast<double>(decodedPrefix) == prefix ? 1 : 0;
+  }
+  return result;
+}
+
+// ---------------------------------------------------------------------------
+// Transactions
+// ---------------------------------------------------------------------------
+
+ParsedTransaction HybridCryptonote::parseTransaction(const std::shared_ptr<ArrayBuffer>& blob) {
+  if (!blob) {
+    throw std::invalid_argument("Transaction blob must not be null");
+  }
+  return Transaction::parse(blob->data(), blob->size());
+}
+
+SerializedTransactionPrefix HybridCryptonote::serializeTransactionPrefix(const TransactionPrefix& prefix) {
+  return Transaction::serializePrefix(prefix);
+}
+
+// ---------------------------------------------------------------------------
+// Random scalars: random_scalar (64 random bytes, sc_reduce) for a whole batch
+// ---------------------------------------------------------------------------
+
+std::shared_ptr<ArrayBuffer> HybridCryptonote::randomScalars(double count) {
+  constexpr double MAX_SCALARS = 65536;
+  if (!(count >= 1 && count <= MAX_SCALARS) || std::floor(count) != count) {
+    throw std::invalid_argument("Scalar count must be an integer between 1 and 65536");
+  }
+  size_t n = static_cast<size_t>(count);
+
+  // One RNG call for the whole batch, then reduce each 64-byte chunk in place
+  std::vector<uint8_t> wide(n * 64);
+  mn_random_fill(wide.data(), wide.size());
+  auto result = ArrayBuffer::allocate(n * CRYPTONOTE_KEY_SIZE);
+  uint8_t* out = result->data();
+  for (size_t i = 0; i < n; ++i) {
+    uint8_t* chunk = wide.data() + i * 64;
+    sc_reduce(chunk);
+    std::memcpy(out + i * CRYPTONOTE_KEY_SIZE, chunk, CRYPTONOTE_KEY_SIZE);
+  }
+  sodium_memzero(wide.data(), wide.size());
+  return result;
+}
+
+// ---------------------------------------------------------------------------
+// Promise variants: inputs retained on the JS thread, work on the ThreadPool
+// ---------------------------------------------------------------------------
+
+std::shared_ptr<Promise<std::vector<std::string>>> HybridCryptonote::generateRingSignatureAsync(
+  const std::string& prefixHashHex,
+  const std::string& keyImageHex,
+  const std::vector<std::string>& publicKeysHex,
+  const SecretKeyHexArg& secretKeyHex,
+  double secretIndex
+) {
+  return runAsync<std::vector<std::string>>(TaskPriority::High,
+    [prefixHashHex, keyImageHex, publicKeysHex, secretKey = retainForAsync(secretKeyHex), secretIndex] {
+      return ringSignatureHex(prefixHashHex, keyImageHex, publicKeysHex, secretKey, secretIndex);
+    });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridCryptonote::generateRingSignatureBinAsync(
+  const std::shared_ptr<ArrayBuffer>& prefixHash,
+  const std::shared_ptr<ArrayBuffer>& keyImage,
+  const std::shared_ptr<ArrayBuffer>& publicKeys,
+  const SecretKeyBinArg& secretKey,
+  double secretIndex
+) {
+  auto self = std::dynamic_pointer_cast<HybridCryptonote>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::High,
+    [self, prefixHash = retainForAsync(prefixHash), keyImage = retainForAsync(keyImage),
+     publicKeys = retainForAsync(publicKeys), secretKey = retainForAsync(secretKey), secretIndex] {
+      return self->generateRingSignatureBin(prefixHash, keyImage, publicKeys, secretKey, secretIndex);
+    });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridCryptonote::validateAddressesAsync(
+  const std::vector<std::string>& addresses,
+  double prefix
+) {
+  auto self = std::dynamic_pointer_cast<HybridCryptonote>(shared_from_this());
+  return runAsync<std::shared_ptr<ArrayBuffer>>(TaskPriority::Low, [self, addresses, prefix] {
+    return self->validateAddresses(addresses, prefix);
+  });
+}
+
+// ---------------------------------------------------------------------------
+// Secret key handles: keys that stay in guarded native memory
+// ---------------------------------------------------------------------------
+
+std::shared_ptr<HybridSecretKeyHandleSpec> HybridCryptonote::importSecretKey(
+  const std::shared_ptr<ArrayBuffer>& secretKey
+) {
+  return std::make_shared<HybridSecretKeyHandle>(keyBytes(secretKey, "secretKey"));
+}
+
+std::shared_ptr<HybridSecretKeyHandleSpec> HybridCryptonote::importSecretKeyHex(
+  const std::string& secretKeyHex
+) {
+  return withSecretKeyHex(secretKeyHex, "secretKey", [](const uint8_t* sec) {
+    return std::make_shared<HybridSecretKeyHandle>(sec);
+  });
+}
+
+std::shared_ptr<HybridSecretKeyHandleSpec> HybridCryptonote::generateSecretKey() {
+  return HybridSecretKeyHandle::generate();
+}
+
 }  // namespace margelo::nitro::concealcrypto
@@ -9,8 +9,10 @@
 #pragma once
 
 #include "../nitrogen/generated/shared/c++/HybridCryptonoteSpec.hpp"
+#include "HexCodec.hpp"
 #include <array>
 #include <memory>
+#include <variant>
 
 namespace margelo::nitro::concealcrypto {
 
@@ -20,10 +22,20 @@ using namespace margelo::nitro;
 constexpr size_t CRYPTONOTE_KEY_SIZE = 32;
 constexpr size_t CRYPTONOTE_POINT_SIZE = 32;
 constexpr size_t CRYPTONOTE_DERIVATION_SIZE = 32;
+constexpr size_t CRYPTONOTE_SIGNATURE_SIZE = 64;
+constexpr size_t CRYPTONOTE_ADDRESS_CHECKSUM_SIZE = 4;
+
+// Largest ring accepted by the ring signature calls. generate_ring_signature
+// keeps 64 bytes per member on the stack, which must fit pool worker stacks.
+constexpr size_t CRYPTONOTE_MAX_RING_SIZE = 1024;
 
 // Maximum varint size for 64-bit integer: ceil(64 / 7) = 10 bytes
 constexpr size_t MAX_VARINT_SIZE = (sizeof(uint64_t) * 8 + 6) / 7;
 
+// Secret key arguments: raw bytes (binary or hex) or a native SecretKeyHandle
+using SecretKeyBinArg = std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>;
+using SecretKeyHexArg = std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>;
+
 // Pre-allocated static buffers for frequently used operations
 class CryptonoteBuffers {
 public:
@@ -38,39 +50,15 @@ public:
 
 // Optimized inline helper functions
 namespace cryptonote_utils {
-  // Fast hex to bytes conversion (optimized for 32-byte keys)
+  // Hex to bytes conversion (vectorized, see HexCodec)
   inline bool hextobin(const std::string& hex, uint8_t* out, size_t expected_size) noexcept {
     if (hex.length() != expected_size * 2) return false;
-    
-    for (size_t i = 0; i < expected_size; ++i) {
-      char high = hex[i * 2];
-      char low = hex[i * 2 + 1];
-      
-      // Fast hex digit conversion
-      uint8_t h = (high >= '0' && high <= '9') ? (high - '0') :
-                  (high >= 'a' && high <= 'f') ? (high - 'a' + 10) :
-                  (high >= 'A' && high <= 'F') ? (high - 'A' + 10) : 0xFF;
-      uint8_t l = (low >= '0' && low <= '9') ? (low - '0') :
-                  (low >= 'a' && low <= 'f') ? (low - 'a' + 10) :
-                  (low >= 'A' && low <= 'F') ? (low - 'A' + 10) : 0xFF;
-      
-      if (h == 0xFF || l == 0xFF) return false;
-      out[i] = (h << 4) | l;
-    }
-    return true;
+    return HexCodec::decode(hex.data(), hex.length(), out);
   }
   
-  // Fast bytes to hex conversion
-  inline std::string bintohex(const uint8_t* data, size_t size) noexcept {
-    static const char hex_chars[] = "0123456789abcdef";
-    std::string result;
-    result.reserve(size * 2);
-    
-    for (size_t i = 0; i < size; ++i) {
-      result += hex_chars[(data[i] >> 4) & 0x0F];
-      result += hex_chars[data[i] & 0x0F];
-    }
-    return result;
+  // Bytes to hex conversion (vectorized, see HexCodec)
+  inline std::string bintohex(const uint8_t* data, size_t size) {
+    return HexCodec::encode(data, size);
   }
   
   // Validate hex string length
@@ -89,7 +77,7 @@ public:
   
   std::string generateKeyDerivation(
     const std::string& publicKeyHex, 
-    const std::string& secretKeyHex
+    const SecretKeyHexArg& secretKeyHex
   ) override;
   
   std::string derivePublicKey(
@@ -100,7 +88,7 @@ public:
   
   std::string geScalarmult(
     const std::string& publicKeyHex, 
-    const std::string& secretKeyHex
+    const SecretKeyHexArg& secretKeyHex
   ) override;
   
   std::string geAdd(
@@ -109,7 +97,7 @@ public:
   ) override;
   
   std::string geScalarmultBase(
-    const std::string& secretKeyHex
+    const SecretKeyHexArg& secretKeyHex
   ) override;
   
   std::string geDoubleScalarmultBaseVartime(
@@ -137,10 +125,147 @@ public:
     const std::string& prefixHashHex,
     const std::string& keyImageHex,
     const std::vector<std::string>& publicKeysHex,
-    const std::string& secretKeyHex,
+    const SecretKeyHexArg& secretKeyHex,
+    double secretIndex
+  ) override;
+
+  // Binary variants: 32-byte ArrayBuffers in and out, no hex round-trip
+  std::shared_ptr<ArrayBuffer> generateKeyDerivationBin(
+    const std::shared_ptr<ArrayBuffer>& publicKey,
+    const SecretKeyBinArg& secretKey
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> derivePublicKeyBin(
+    const std::shared_ptr<ArrayBuffer>& derivation,
+    double outputIndex,
+    const std::shared_ptr<ArrayBuffer>& publicKey
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> geScalarmultBin(
+    const std::shared_ptr<ArrayBuffer>& publicKey,
+    const SecretKeyBinArg& secretKey
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> geAddBin(
+    const std::shared_ptr<ArrayBuffer>& point1,
+    const std::shared_ptr<ArrayBuffer>& point2
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> geScalarmultBaseBin(
+    const SecretKeyBinArg& secretKey
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> geDoubleScalarmultBaseVartimeBin(
+    const std::shared_ptr<ArrayBuffer>& c,
+    const std::shared_ptr<ArrayBuffer>& P,
+    const std::shared_ptr<ArrayBuffer>& r
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> geDoubleScalarmultPostcompVartimeBin(
+    const std::shared_ptr<ArrayBuffer>& r,
+    const std::shared_ptr<ArrayBuffer>& P,
+    const std::shared_ptr<ArrayBuffer>& c,
+    const std::shared_ptr<ArrayBuffer>& I
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> cnFastHashBin(
+    const std::shared_ptr<ArrayBuffer>& input
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> encodeVarintBin(
+    double value
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> generateRingSignatureBin(
+    const std::shared_ptr<ArrayBuffer>& prefixHash,
+    const std::shared_ptr<ArrayBuffer>& keyImage,
+    const std::shared_ptr<ArrayBuffer>& publicKeys,
+    const SecretKeyBinArg& secretKey,
     double secretIndex
   ) override;
 
+  // Batch varints
+  VarintBatchResult encodeVarints(
+    const std::shared_ptr<ArrayBuffer>& values,
+    const std::optional<bool>& bigint
+  ) override;
+  
+  VarintBatchResult decodeVarints(
+    const std::shared_ptr<ArrayBuffer>& data
+  ) override;
+
+  // Ring member offsets
+  RingOffsetsResult absoluteToRelativeOffsets(
+    const std::shared_ptr<ArrayBuffer>& absolute,
+    const std::shared_ptr<ArrayBuffer>& ringSizes
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> relativeToAbsoluteOffsets(
+    const std::shared_ptr<ArrayBuffer>& relative,
+    const std::shared_ptr<ArrayBuffer>& ringSizes
+  ) override;
+
+  // Base58 addresses
+  std::string encodeAddress(
+    double prefix,
+    const std::string& spendPublicKeyHex,
+    const std::string& viewPublicKeyHex
+  ) override;
+  
+  DecodedAddress decodeAddress(
+    const std::string& address
+  ) override;
+  
+  std::shared_ptr<ArrayBuffer> validateAddresses(
+    const std::vector<std::string>& addresses,
+    double prefix
+  ) override;
+
+  // Transactions
+  ParsedTransaction parseTransaction(
+    const std::shared_ptr<ArrayBuffer>& blob
+  ) override;
+  
+  SerializedTransactionPrefix serializeTransactionPrefix(
+    const TransactionPrefix& prefix
+  ) override;
+
+  // Random scalars
+  std::shared_ptr<ArrayBuffer> randomScalars(double count) override;
+
+  // Promise variants, run on the shared ThreadPool
+  std::shared_ptr<Promise<std::vector<std::string>>> generateRingSignatureAsync(
+    const std::string& prefixHashHex,
+    const std::string& keyImageHex,
+    const std::vector<std::string>& publicKeysHex,
+    const SecretKeyHexArg& secretKeyHex,
+    double secretIndex
+  ) override;
+  
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> generateRingSignatureBinAsync(
+    const std::shared_ptr<ArrayBuffer>& prefixHash,
+    const std::shared_ptr<ArrayBuffer>& keyImage,
+    const std::shared_ptr<ArrayBuffer>& publicKeys,
+    const SecretKeyBinArg& secretKey,
+    double secretIndex
+  ) override;
+  
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> validateAddressesAsync(
+    const std::vector<std::string>& addresses,
+    double prefix
+  ) override;
+
+  // Secret key handles
+  std::shared_ptr<HybridSecretKeyHandleSpec> importSecretKey(
+    const std::shared_ptr<ArrayBuffer>& secretKey
+  ) override;
+  
+  std::shared_ptr<HybridSecretKeyHandleSpec> importSecretKeyHex(
+    const std::string& secretKeyHex
+  ) override;
+  
+  std::shared_ptr<HybridSecretKeyHandleSpec> generateSecretKey() override;
+
 private:
   // Fast validation for hex strings
   inline bool validateHexInput(const std::string& hex) const noexcept {
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "HybridHmacKey.hpp"
+#include <sodium.h>
+#include <stdexcept>
+
+using namespace margelo::nitro;
+using namespace margelo::nitro::concealcrypto;
+
+/**
+ * Absorbs key^ipad and key^opad once; the raw key is not retained.
+ */
+HybridHmacKey::HybridHmacKey(const std::shared_ptr<ArrayBuffer>& key) : HybridObject(TAG) {
+  if (!key) throw std::invalid_argument("Key must not be null");
+  Hmac::hmacSha1Init(_state, static_cast<const uint8_t*>(key->data()), key->size());
+}
+
+HybridHmacKey::~HybridHmacKey() {
+  sodium_memzero(&_state, sizeof(_state));
+}
+
+/**
+ * HMAC-SHA1 from the cached midstates
+ */
+std::shared_ptr<ArrayBuffer> HybridHmacKey::sign(const std::shared_ptr<ArrayBuffer>& data) {
+  if (!data) throw std::invalid_argument("Data must not be null");
+
+  auto result = ArrayBuffer::allocate(SHA1_DIGEST_SIZE);
+  Hmac::hmacSha1Mac(_state, static_cast<const uint8_t*>(data->data()), data->size(),
+                    static_cast<uint8_t*>(result->data()));
+  return result;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "../nitrogen/generated/shared/c++/HybridHmacKeySpec.hpp"
+#include "Hmac.hpp"
+#include <memory>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * HMAC-SHA1 key with cached inner/outer SHA-1 midstates
+ */
+class HybridHmacKey : public HybridHmacKeySpec {
+ public:
+  /**
+   * @param key The secret key (any length)
+   */
+  explicit HybridHmacKey(const std::shared_ptr<ArrayBuffer>& key);
+  ~HybridHmacKey() override;
+
+  std::shared_ptr<ArrayBuffer> sign(const std::shared_ptr<ArrayBuffer>& data) override;
+
+ private:
+  HmacSha1State _state;
+};
+
+}  // namespace margelo::nitro::concealcrypto
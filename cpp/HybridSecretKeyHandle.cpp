@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "HybridSecretKeyHandle.hpp"
+#include "mn_random.h"
+#include <cstring>
+#include <mutex>
+#include <sodium.h>
+
+extern "C" {
+  #include "Cryptonote/crypto-ops.h"
+}
+
+using namespace margelo::nitro;
+using namespace margelo::nitro::concealcrypto;
+
+/**
+ * Guarded allocation only; callers fill the key
+ */
+HybridSecretKeyHandle::HybridSecretKeyHandle() : HybridObject(TAG) {
+  _key = static_cast<uint8_t*>(sodium_malloc(KEY_SIZE));
+  if (_key == nullptr) {
+    throw std::runtime_error("Failed to allocate guarded memory for secret key");
+  }
+}
+
+HybridSecretKeyHandle::HybridSecretKeyHandle(const uint8_t* secretKey) : HybridSecretKeyHandle() {
+  // The delegated constructor has completed, so the destructor frees _key on throw
+  if (sc_check(secretKey) != 0) {
+    throw std::invalid_argument("Invalid secret key: not a reduced scalar");
+  }
+  std::memcpy(_key, secretKey, KEY_SIZE);
+}
+
+HybridSecretKeyHandle::~HybridSecretKeyHandle() {
+  wipe();
+}
+
+/**
+ * Same reduction as random_scalar, done inside the guarded allocation
+ */
+std::shared_ptr<HybridSecretKeyHandle> HybridSecretKeyHandle::generate() {
+  std::shared_ptr<HybridSecretKeyHandle> handle(new HybridSecretKeyHandle());
+  uint8_t wide[64];
+  mn_random_fill(wide, sizeof(wide));
+  sc_reduce(wide);
+  std::memcpy(handle->_key, wide, KEY_SIZE);
+  sodium_memzero(wide, sizeof(wide));
+  return handle;
+}
+
+/**
+ * Public key sec*G
+ */
+std::shared_ptr<ArrayBuffer> HybridSecretKeyHandle::getPublicKey() {
+  auto result = ArrayBuffer::allocate(KEY_SIZE);
+  use([&](const uint8_t* sec) {
+    ge_p3 point;
+    ge_scalarmult_base(&point, sec);
+    ge_p3_tobytes(result->data(), &point);
+  });
+  return result;
+}
+
+/**
+ * Zero and release the key now instead of waiting for garbage collection
+ */
+void HybridSecretKeyHandle::wipe() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (_key != nullptr) {
+    sodium_memzero(_key, KEY_SIZE);
+    sodium_free(_key);
+    _key = nullptr;
+  }
+}
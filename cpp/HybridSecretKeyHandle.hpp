@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "../nitrogen/generated/shared/c++/HybridSecretKeyHandleSpec.hpp"
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <stdexcept>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Cryptonote secret key kept in native memory
+ * The 32 key bytes live in a sodium_malloc allocation (guard pages, locked
+ * against swapping) and are wiped with sodium_memzero by wipe() or on release,
+ * so the secret never has to exist as a JS string or ArrayBuffer.
+ */
+class HybridSecretKeyHandle : public HybridSecretKeyHandleSpec {
+ public:
+  static constexpr size_t KEY_SIZE = 32;
+
+  /**
+   * @param secretKey 32-byte reduced scalar (copied)
+   * @throws std::invalid_argument if the key is not a reduced scalar
+   * @throws std::runtime_error if guarded memory cannot be allocated
+   */
+  explicit HybridSecretKeyHandle(const uint8_t* secretKey);
+  ~HybridSecretKeyHandle() override;
+
+  /**
+   * New handle holding a uniformly random scalar generated in place
+   */
+  static std::shared_ptr<HybridSecretKeyHandle> generate();
+
+  std::shared_ptr<ArrayBuffer> getPublicKey() override;
+  void wipe() override;
+
+  /**
+   * Run fn(keyBytes) with the key locked against a concurrent wipe()
+   * @throws std::runtime_error if the handle was already wiped
+   */
+  template <typename Fn>
+  auto use(Fn&& fn) const {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    if (_key == nullptr) {
+      throw std::runtime_error("Secret key handle has been wiped");
+    }
+    return fn(static_cast<const uint8_t*>(_key));
+  }
+
+ private:
+  HybridSecretKeyHandle();
+
+  mutable std::shared_mutex _mutex;
+  uint8_t* _key = nullptr;
+};
+
+}  // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "HybridSecretStream.hpp"
+#include <stdexcept>
+
+using namespace margelo::nitro;
+using namespace margelo::nitro::concealcrypto;
+
+/**
+ * Generates a fresh header and initializes the push state.
+ */
+HybridSecretStreamPush::HybridSecretStreamPush(const std::shared_ptr<ArrayBuffer>& key)
+    : HybridObject(TAG) {
+  if (!key) throw std::invalid_argument("Key must not be null");
+  if (key->size() != crypto_secretstream_xchacha20poly1305_KEYBYTES)
+    throw std::invalid_argument("Invalid key size");
+
+  _header = ArrayBuffer::allocate(crypto_secretstream_xchacha20poly1305_HEADERBYTES);
+  crypto_secretstream_xchacha20poly1305_init_push(
+    &_state,
+    static_cast<unsigned char*>(_header->data()),
+    static_cast<const unsigned char*>(key->data())
+  );
+}
+
+HybridSecretStreamPush::~HybridSecretStreamPush() {
+  sodium_memzero(&_state, sizeof(_state));
+}
+
+std::shared_ptr<ArrayBuffer> HybridSecretStreamPush::getHeader() {
+  return _header;
+}
+
+/**
+ * Seals one chunk directly into the result buffer (no intermediate vector).
+ */
+std::shared_ptr<ArrayBuffer> HybridSecretStreamPush::push(
+  const std::shared_ptr<ArrayBuffer>& message,
+  double tag
+) {
+  if (!message) throw std::invalid_argument("Message must not be null");
+  if (_finished) throw std::runtime_error("Stream already finalized");
+  if (tag != crypto_secretstream_xchacha20poly1305_TAG_MESSAGE &&
+      tag != crypto_secretstream_xchacha20poly1305_TAG_PUSH &&
+      tag != crypto_secretstream_xchacha20poly1305_TAG_REKEY &&
+      tag != crypto_secretstream_xchacha20poly1305_TAG_FINAL)
+    throw std::invalid_argument("Invalid secretstream tag");
+
+  auto ciphertext = ArrayBuffer::allocate(message->size() + crypto_secretstream_xchacha20poly1305_ABYTES);
+
+  int result = crypto_secretstream_xchacha20poly1305_push(
+    &_state,
+    static_cast<unsigned char*>(ciphertext->data()),
+    nullptr,
+    static_cast<const unsigned char*>(message->data()),
+    message->size(),
+    nullptr,
+    0,
+    static_cast<unsigned char>(tag)
+  );
+
+  if (result != 0)
+    throw std::runtime_error("Secretstream encryption failed");
+
+  _finished = tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL;
+  return ciphertext;
+}
+
+void HybridSecretStreamPush::rekey() {
+  if (_finished) throw std::runtime_error("Stream already finalized");
+  crypto_secretstream_xchacha20poly1305_rekey(&_state);
+}
+
+/**
+ * Initializes the pull state from the pushing side's header.
+ */
+HybridSecretStreamPull::HybridSecretStreamPull(
+  const std::shared_ptr<ArrayBuffer>& header,
+  const std::shared_ptr<ArrayBuffer>& key
+) : HybridObject(TAG) {
+  if (!header || !key) throw std::invalid_argument("Header and key must not be null");
+  if (header->size() != crypto_secretstream_xchacha20poly1305_HEADERBYTES)
+    throw std::invalid_argument("Invalid header size");
+  if (key->size() != crypto_secretstream_xchacha20poly1305_KEYBYTES)
+    throw std::invalid_argument("Invalid key size");
+
+  if (crypto_secretstream_xchacha20poly1305_init_pull(
+        &_state,
+        static_cast<const unsigned char*>(header->data()),
+        static_cast<const unsigned char*>(key->data())) != 0)
+    throw std::invalid_argument("Invalid secretstream header");
+}
+
+HybridSecretStreamPull::~HybridSecretStreamPull() {
+  sodium_memzero(&_state, sizeof(_state));
+}
+
+double HybridSecretStreamPull::getTag() {
+  return _tag;
+}
+
+/**
+ * Opens one chunk directly into the result buffer.
+ * Returns std::nullopt if authentication fails (state is left unchanged by libsodium).
+ * Throws once a FINAL chunk has been pulled: anything appended after it is rejected.
+ */
+std::optional<std::shared_ptr<ArrayBuffer>> HybridSecretStreamPull::pull(
+  const std::shared_ptr<ArrayBuffer>& ciphertext
+) {
+  if (!ciphertext) throw std::invalid_argument("Ciphertext must not be null");
+  if (_finished) throw std::runtime_error("Stream already finalized");
+  if (ciphertext->size() < crypto_secretstream_xchacha20poly1305_ABYTES)
+    throw std::invalid_argument("Ciphertext too short");
+
+  auto message = ArrayBuffer::allocate(ciphertext->size() - crypto_secretstream_xchacha20poly1305_ABYTES);
+  unsigned char tag = 0;
+
+  int result = crypto_secretstream_xchacha20poly1305_pull(
+    &_state,
+    static_cast<unsigned char*>(message->data()),
+    nullptr,
+    &tag,
+    static_cast<const unsigned char*>(ciphertext->data()),
+    ciphertext->size(),
+    nullptr,
+    0
+  );
+
+  if (result != 0)
+    return std::nullopt; // Authentication failed
+
+  _tag = tag;
+  _finished = tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL;
+  return message;
+}
+
+void HybridSecretStreamPull::rekey() {
+  if (_finished) throw std::runtime_error("Stream already finalized");
+  crypto_secretstream_xchacha20poly1305_rekey(&_state);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "../nitrogen/generated/shared/c++/HybridSecretStreamPushSpec.hpp"
+#include "../nitrogen/generated/shared/c++/HybridSecretStreamPullSpec.hpp"
+#include <sodium.h>
+#include <memory>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Stateful libsodium crypto_secretstream_xchacha20poly1305 encryptor.
+ * Each push() seals one chunk straight into the returned ArrayBuffer,
+ * so arbitrarily large data is processed with constant memory.
+ */
+class HybridSecretStreamPush : public HybridSecretStreamPushSpec {
+ public:
+  /**
+   * @param key 32-byte secretstream key
+   * @throws std::invalid_argument if the key has the wrong size
+   */
+  explicit HybridSecretStreamPush(const std::shared_ptr<ArrayBuffer>& key);
+  ~HybridSecretStreamPush() override;
+
+  std::shared_ptr<ArrayBuffer> getHeader() override;
+  std::shared_ptr<ArrayBuffer> push(const std::shared_ptr<ArrayBuffer>& message, double tag) override;
+  void rekey() override;
+
+ private:
+  crypto_secretstream_xchacha20poly1305_state _state;
+  std::shared_ptr<ArrayBuffer> _header;
+  bool _finished = false;
+};
+
+/**
+ * Stateful libsodium crypto_secretstream_xchacha20poly1305 decryptor.
+ */
+class HybridSecretStreamPull : public HybridSecretStreamPullSpec {
+ public:
+  /**
+   * @param header 24-byte stream header produced by the pushing side
+   * @param key 32-byte secretstream key
+   * @throws std::invalid_argument if the header or key is invalid
+   */
+  HybridSecretStreamPull(const std::shared_ptr<ArrayBuffer>& header,
+                         const std::shared_ptr<ArrayBuffer>& key);
+  ~HybridSecretStreamPull() override;
+
+  double getTag() override;
+  std::optional<std::shared_ptr<ArrayBuffer>> pull(const std::shared_ptr<ArrayBuffer>& ciphertext) override;
+  void rekey() override;
+
+ private:
+  crypto_secretstream_xchacha20poly1305_state _state;
+  unsigned char _tag = crypto_secretstream_xchacha20poly1305_TAG_MESSAGE;
+  bool _finished = false;
+};
+
+}  // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Mnemonic.hpp"
+#include "MnemonicWordlists.hpp"
+#include <array>
+#include <cstring>
+#include <sodium.h>
+#include <stdexcept>
+#include <string_view>
+
+namespace margelo::nitro::concealcrypto {
+
+using Wordlist = std::array<std::string_view, Mnemonic::WORDLIST_SIZE>;
+
+/**
+ * Perfect hash from a 3-letter prefix to its word index
+ * Buckets are keyed by the first two letters; each holds the index of its first
+ * word and a bitmask of the third letters present. Because the list is sorted,
+ * the rank of the third letter inside the mask is the offset from the bucket start.
+ */
+struct PrefixIndex {
+  std::array<uint16_t, 26 * 26> first{};
+  std::array<uint32_t, 26 * 26> thirdLetters{};
+  bool valid = true;
+};
+
+static constexpr bool isLower(char c) {
+  return c >= 'a' && c <= 'z';
+}
+
+static constexpr bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static constexpr PrefixIndex buildPrefixIndex(const Wordlist& words) {
+  PrefixIndex index;
+  for (size_t i = 0; i < words.size(); i++) {
+    std::string_view word = words[i];
+    if (word.size() < Mnemonic::PREFIX_LENGTH || !isLower(word[0]) || !isLower(word[1]) || !isLower(word[2]) ||
+        (i > 0 && word.substr(0, Mnemonic::PREFIX_LENGTH) <= words[i - 1].substr(0, Mnemonic::PREFIX_LENGTH))) {
+      index.valid = false;
+      return index;
+    }
+    size_t bucket = (word[0] - 'a') * 26 + (word[1] - 'a');
+    if (index.thirdLetters[bucket] == 0) index.first[bucket] = static_cast<uint16_t>(i);
+    index.thirdLetters[bucket] |= 1u << (word[2] - 'a');
+  }
+  return index;
+}
+
+static constexpr PrefixIndex ENGLISH_INDEX = buildPrefixIndex(wordlists::ENGLISH);
+static_assert(ENGLISH_INDEX.valid, "English wordlist must be sorted with unique lowercase 3-letter prefixes");
+
+struct Language {
+  const char* name;
+  const Wordlist& words;
+  const PrefixIndex& index;
+};
+
+static constexpr Language LANGUAGES[] = {
+  {"english", wordlists::ENGLISH, ENGLISH_INDEX},
+};
+
+// zlib CRC32 (reflected 0xEDB88320)
+static constexpr std::array<uint32_t, 256> CRC32_TABLE = [] {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    table[i] = crc;
+  }
+  return table;
+}();
+
+static uint32_t crc32Update(uint32_t crc, std::string_view data) {
+  for (char c : data) crc = CRC32_TABLE[(crc ^ static_cast<uint8_t>(c)) & 0xFF] ^ (crc >> 8);
+  return crc;
+}
+
+static const Language& findLanguage(const std::string& name) {
+  for (const Language& language : LANGUAGES) {
+    if (name.size() != std::strlen(language.name)) continue;
+    bool match = true;
+    for (size_t i = 0; i < name.size() && match; i++) {
+      char c = name[i];
+      if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+      match = c == language.name[i];
+    }
+    if (match) return language;
+  }
+  throw std::invalid_argument("Unsupported mnemonic language: " + name);
+}
+
+// Word index for a lowercased word, -1 if its prefix is not in the list
+static int lookup(const Language& language, std::string_view word) {
+  if (word.size() < Mnemonic::PREFIX_LENGTH || !isLower(word[0]) || !isLower(word[1]) || !isLower(word[2])) return -1;
+  size_t bucket = (word[0] - 'a') * 26 + (word[1] - 'a');
+  uint32_t bit = 1u << (word[2] - 'a');
+  uint32_t mask = language.index.thirdLetters[bucket];
+  if (!(mask & bit)) return -1;
+  return language.index.first[bucket] + __builtin_popcount(mask & (bit - 1));
+}
+
+// CRC32 over the concatenated prefixes, reduced to a word position
+static size_t checksumPosition(const std::vector<std::string_view>& words) {
+  uint32_t crc = 0xFFFFFFFFu;
+  for (std::string_view word : words) crc = crc32Update(crc, word.substr(0, Mnemonic::PREFIX_LENGTH));
+  return (crc ^ 0xFFFFFFFFu) % words.size();
+}
+
+std::string Mnemonic::encode(const uint8_t* entropy, size_t length, const std::string& language) {
+  if (length == 0 || length % 4 != 0) {
+    throw std::invalid_argument("Invalid mnemonic entropy: length must be a non-zero multiple of 4 bytes");
+  }
+  const Language& lang = findLanguage(language);
+  constexpr uint32_t n = WORDLIST_SIZE;
+
+  std::vector<std::string_view> words;
+  words.reserve(length / 4 * 3);
+  for (size_t i = 0; i < length; i += 4) {
+    uint32_t x = static_cast<uint32_t>(entropy[i]) | static_cast<uint32_t>(entropy[i + 1]) << 8 |
+                 static_cast<uint32_t>(entropy[i + 2]) << 16 | static_cast<uint32_t>(entropy[i + 3]) << 24;
+    uint32_t w1 = x % n;
+    uint32_t w2 = (x / n + w1) % n;
+    uint32_t w3 = (x / n / n + w2) % n;
+    words.push_back(lang.words[w1]);
+    words.push_back(lang.words[w2]);
+    words.push_back(lang.words[w3]);
+  }
+  std::string_view checksum = words[checksumPosition(words)];
+
+  size_t size = checksum.size();
+  for (std::string_view word : words) size += word.size() + 1;
+  std::string out;
+  out.reserve(size);
+  for (std::string_view word : words) {
+    out.append(word);
+    out.push_back(' ');
+  }
+  out.append(checksum);
+  return out;
+}
+
+std::vector<uint8_t> Mnemonic::decode(const std::string& words) {
+  // Split on ASCII whitespace and lowercase in place; the copy holds the whole
+  // seed phrase, so it is wiped on every exit path
+  struct ScopedPhrase {
+    std::string data;
+    ~ScopedPhrase() { sodium_memzero(data.data(), data.size()); }
+  } phrase{words};
+  std::string& lowered = phrase.data;
+  std::vector<std::string_view> list;
+  for (size_t i = 0; i < lowered.size();) {
+    while (i < lowered.size() && isSpace(lowered[i])) i++;
+    size_t start = i;
+    while (i < lowered.size() && !isSpace(lowered[i])) {
+      if (lowered[i] >= 'A' && lowered[i] <= 'Z') lowered[i] = static_cast<char>(lowered[i] - 'A' + 'a');
+      i++;
+    }
+    if (i > start) list.emplace_back(lowered.data() + start, i - start);
+  }
+
+  if (list.size() < 3 || list.size() % 3 == 2) {
+    throw std::invalid_argument("Invalid mnemonic: expected 3n or 3n + 1 words, got " + std::to_string(list.size()));
+  }
+  const Language& lang = LANGUAGES[0];
+
+  std::string_view checksum;
+  if (list.size() % 3 == 1) {
+    checksum = list.back();
+    list.pop_back();
+  }
+
+  constexpr uint64_t n = WORDLIST_SIZE;
+  // Wiped if a later word is rejected; emptied by the move on success
+  struct ScopedEntropy {
+    std::vector<uint8_t> data;
+    ~ScopedEntropy() { sodium_memzero(data.data(), data.size()); }
+  } entropy{std::vector<uint8_t>(list.size() / 3 * 4)};
+  std::vector<uint8_t>& out = entropy.data;
+  for (size_t i = 0; i < list.size(); i += 3) {
+    int index[3];
+    for (size_t j = 0; j < 3; j++) {
+      index[j] = lookup(lang, list[i + j]);
+      if (index[j] < 0) {
+        throw std::invalid_argument("Invalid mnemonic: unknown word at position " + std::to_string(i + j + 1));
+      }
+    }
+    uint64_t w1 = index[0], w2 = index[1], w3 = index[2];
+    uint64_t x = w1 + n * ((n - w1 + w2) % n) + n * n * ((n - w2 + w3) % n);
+    if (x > UINT32_MAX) {
+      throw std::invalid_argument("Invalid mnemonic: words " + std::to_string(i + 1) + "-" + std::to_string(i + 3) +
+                                  " do not encode a 32-bit value");
+    }
+    for (size_t b = 0; b < 4; b++) out[i / 3 * 4 + b] = static_cast<uint8_t>(x >> (8 * b));
+  }
+
+  if (!checksum.empty() && lookup(lang, checksum) != lookup(lang, list[checksumPosition(list)])) {
+    throw std::invalid_argument("Invalid mnemonic: checksum word mismatch");
+  }
+  return std::move(out);
+}
+
+} // namespace margelo::nitro::concealcrypto
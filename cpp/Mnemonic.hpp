@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Electrum-style mnemonic seeds (Cryptonote 25-word format)
+ * Every 4 bytes of entropy become 3 words; a final checksum word is picked by
+ * CRC32 over the 3-letter word prefixes. Words are resolved by prefix only,
+ * so abbreviated seeds decode too.
+ */
+class Mnemonic {
+public:
+  static constexpr size_t WORDLIST_SIZE = 1626;
+  static constexpr size_t PREFIX_LENGTH = 3;
+
+  /**
+   * Encode entropy as words plus the checksum word
+   * @param entropy Entropy bytes (non-empty multiple of 4)
+   * @param length Number of entropy bytes
+   * @param language Wordlist name ("english", case-insensitive)
+   * @return Space-separated words
+   * @throws std::invalid_argument on bad length or unknown language
+   */
+  static std::string encode(const uint8_t* entropy, size_t length, const std::string& language);
+
+  /**
+   * Decode words back to entropy
+   * Accepts 3n words, or 3n + 1 words where the last one is the checksum word.
+   * @param words Whitespace-separated words
+   * @return Entropy bytes (4 per 3 words)
+   * @throws std::invalid_argument on bad word count, unknown word, invalid triple or checksum mismatch
+   */
+  static std::vector<uint8_t> decode(const std::string& words);
+};
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Otp.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace margelo::nitro::concealcrypto {
+
+// 10^digits for digits in [0, 10]
+constexpr uint64_t POW10[] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+  10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL
+};
+
+Otp::Algorithm Otp::parseAlgorithm(const std::string& name) {
+  if (name == "SHA1") return Algorithm::SHA1;
+  if (name == "SHA256") return Algorithm::SHA256;
+  if (name == "SHA512") return Algorithm::SHA512;
+  throw std::invalid_argument("Unsupported OTP algorithm: " + name + " (expected SHA1, SHA256 or SHA512)");
+}
+
+void Otp::initKey(Key& key, Algorithm algorithm, const uint8_t* secret, size_t secretLength) noexcept {
+  key.algorithm = algorithm;
+  switch (algorithm) {
+    case Algorithm::SHA1:
+      Hmac::hmacSha1Init(key.sha1, secret, secretLength);
+      break;
+    case Algorithm::SHA256:
+      crypto_auth_hmacsha256_init(&key.sha256, secret, secretLength);
+      break;
+    case Algorithm::SHA512:
+      crypto_auth_hmacsha512_init(&key.sha512, secret, secretLength);
+      break;
+  }
+}
+
+uint32_t Otp::hotp(const Key& key, uint64_t counter, int digits) noexcept {
+  // Counter as 8-byte big-endian message
+  uint8_t message[8];
+  for (int i = 7; i >= 0; i--) {
+    message[i] = static_cast<uint8_t>(counter);
+    counter >>= 8;
+  }
+
+  uint8_t mac[crypto_auth_hmacsha512_BYTES];
+  size_t macLength = 0;
+  switch (key.algorithm) {
+    case Algorithm::SHA1:
+      Hmac::hmacSha1Mac(key.sha1, message, sizeof(message), mac);
+      macLength = SHA1_DIGEST_SIZE;
+      break;
+    case Algorithm::SHA256: {
+      crypto_auth_hmacsha256_state state = key.sha256;
+      crypto_auth_hmacsha256_update(&state, message, sizeof(message));
+      crypto_auth_hmacsha256_final(&state, mac);
+      macLength = crypto_auth_hmacsha256_BYTES;
+      break;
+    }
+    case Algorithm::SHA512: {
+      crypto_auth_hmacsha512_state state = key.sha512;
+      crypto_auth_hmacsha512_update(&state, message, sizeof(message));
+      crypto_auth_hmacsha512_final(&state, mac);
+      macLength = crypto_auth_hmacsha512_BYTES;
+      break;
+    }
+  }
+
+  // Dynamic truncation (RFC 4226 section 5.3)
+  size_t offset = mac[macLength - 1] & 0x0F;
+  uint32_t binary = (static_cast<uint32_t>(mac[offset] & 0x7F) << 24) |
+                    (static_cast<uint32_t>(mac[offset + 1]) << 16) |
+                    (static_cast<uint32_t>(mac[offset + 2]) << 8) |
+                    static_cast<uint32_t>(mac[offset + 3]);
+
+  return static_cast<uint32_t>(binary % POW10[digits]);
+}
+
+bool Otp::verify(const Key& key, const std::string& code, uint64_t counter, int window, int digits) {
+  // The expected length is fixed by the caller: a shorter code would be
+  // checked against a weaker truncation
+  if (code.size() != static_cast<size_t>(digits)) return false;
+  for (char c : code) {
+    if (c < '0' || c > '9') return false;
+  }
+
+  bool match = false;
+  for (int64_t offset = -window; offset <= window; offset++) {
+    if (offset < 0 && static_cast<uint64_t>(-offset) > counter) continue;
+    std::string candidate = format(hotp(key, counter + offset, digits), digits);
+    match |= sodium_memcmp(candidate.data(), code.data(), code.size()) == 0;
+  }
+  return match;
+}
+
+std::string Otp::format(uint32_t value, int digits) {
+  std::string code(static_cast<size_t>(digits), '0');
+  for (int i = digits - 1; i >= 0 && value > 0; i--) {
+    code[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return code;
+}
+
+uint64_t Otp::timeCounter(double time, double step) {
+  if (!(step >= 1) || step != std::floor(step))
+    throw std::invalid_argument("TOTP step must be a positive integer");
+  if (!(time >= 0))
+    throw std::invalid_argument("TOTP time must be non-negative");
+  double counter = std::floor(time / step);
+  if (!(counter < 18446744073709551616.0))
+    throw std::invalid_argument("TOTP time out of range");
+  return static_cast<uint64_t>(counter);
+}
+
+int Otp::checkDigits(double digits) {
+  if (!(digits >= 1 && digits <= 10) || digits != std::floor(digits))
+    throw std::invalid_argument("OTP digits must be an integer between 1 and 10");
+  return static_cast<int>(digits);
+}
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "Hmac.hpp"
+#include <sodium.h>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * HOTP (RFC 4226) / TOTP (RFC 6238) one-time passwords
+ * The HMAC key state is precomputed once per call, so verifying a ±N window
+ * costs 2N+1 message-only MACs in a single native call.
+ */
+class Otp {
+public:
+  enum class Algorithm { SHA1, SHA256, SHA512 };
+
+  /**
+   * Precomputed HMAC key state for the selected algorithm
+   */
+  struct Key {
+    Algorithm algorithm;
+    union {
+      HmacSha1State sha1;
+      crypto_auth_hmacsha256_state sha256;
+      crypto_auth_hmacsha512_state sha512;
+    };
+  };
+
+  /**
+   * Parse "SHA1", "SHA256" or "SHA512"
+   * @throws std::invalid_argument for any other name
+   */
+  static Algorithm parseAlgorithm(const std::string& name);
+
+  /**
+   * Precompute the HMAC state for a secret
+   */
+  static void initKey(Key& key, Algorithm algorithm, const uint8_t* secret, size_t secretLength) noexcept;
+
+  /**
+   * HOTP value for one counter (dynamic truncation, modulo 10^digits)
+   */
+  static uint32_t hotp(const Key& key, uint64_t counter, int digits) noexcept;
+
+  /**
+   * Check a code against counters [counter - window, counter + window]
+   * Every step is computed (no early exit) and compared in constant time.
+   * @return false if the code is not exactly digits decimal characters or no step matches
+   */
+  static bool verify(const Key& key, const std::string& code, uint64_t counter, int window, int digits);
+
+  /**
+   * Zero-padded decimal representation of an OTP value
+   */
+  static std::string format(uint32_t value, int digits);
+
+  /**
+   * TOTP time step counter: floor(time / step)
+   * @throws std::invalid_argument if time is negative or step is not positive
+   */
+  static uint64_t timeCounter(double time, double step);
+
+  /**
+   * Validate a digits argument (1 to 10; the truncated value has 31 bits)
+   * @throws std::invalid_argument if out of range
+   */
+  static int checkDigits(double digits);
+};
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "ParallelChacha.hpp"
+#include "ThreadPool.hpp"
+#include "chacha.h"
+#include <algorithm>
+
+namespace margelo::nitro::concealcrypto {
+
+static_assert(ParallelChacha::CHUNK_SIZE % CHACHA_BLOCK_SIZE == 0,
+              "Chunks must start on a keystream block boundary");
+
+template <typename ChunkFn>
+void ParallelChacha::forEachChunk(size_t length, ChunkFn&& chunkFn) {
+  ThreadPool& pool = ThreadPool::shared();
+  if (length < PARALLEL_THRESHOLD || pool.size() == 0) {
+    chunkFn(0, length);
+    return;
+  }
+
+  const size_t chunks = (length + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  pool.parallelFor(chunks, [&](size_t chunk) {
+    const size_t offset = chunk * CHUNK_SIZE;
+    chunkFn(offset, std::min(CHUNK_SIZE, length - offset));
+  });
+}
+
+void ParallelChacha::xorStream(const uint8_t* data, size_t length, const uint8_t* key,
+                               const uint8_t* iv, uint8_t* cipher, int rounds, uint64_t counter) {
+  forEachChunk(length, [=](size_t offset, size_t len) {
+    chacha_xor(data + offset, len, key, iv, counter + offset / CHACHA_BLOCK_SIZE, cipher + offset,
+               rounds);
+  });
+}
+
+void ParallelChacha::xorStreamIetf(const uint8_t* data, size_t length, const uint8_t* key,
+                                   const uint8_t* nonce, uint32_t counter, uint8_t* cipher,
+                                   int rounds) {
+  forEachChunk(length, [=](size_t offset, size_t len) {
+    chacha_ietf_xor(data + offset, len, key, nonce,
+                    counter + static_cast<uint32_t>(offset / CHACHA_BLOCK_SIZE), cipher + offset,
+                    rounds);
+  });
+}
+
+} // namespace margelo::nitro::concealcrypto
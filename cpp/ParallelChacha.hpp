@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Chunked multi-threaded ChaCha XOR for large buffers (e.g. wallet cache).
+ * ChaCha is counter-mode, so the input is split into 64-byte aligned chunks
+ * whose first block counter is offset / 64; the output is byte-identical
+ * to the serial chacha*_xor functions.
+ */
+class ParallelChacha {
+public:
+  // Inputs below this size stay on the calling thread (thread hand-off would dominate)
+  static constexpr size_t PARALLEL_THRESHOLD = 256 * 1024;
+  // Work item size, a multiple of CHACHA_BLOCK_SIZE
+  static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+  /**
+   * XOR data with the ChaCha keystream, using the shared ThreadPool above PARALLEL_THRESHOLD
+   * @param data Input bytes
+   * @param length Input length
+   * @param key 32-byte key
+   * @param iv 8-byte IV
+   * @param cipher Output bytes (may alias data)
+   * @param rounds ChaCha rounds (8, 12 or 20)
+   * @param counter Initial 64-bit block counter
+   */
+  static void xorStream(const uint8_t* data, size_t length, const uint8_t* key,
+                        const uint8_t* iv, uint8_t* cipher, int rounds, uint64_t counter = 0);
+
+  /**
+   * Same as xorStream for the IETF layout (12-byte nonce, 32-bit block counter)
+   * The caller must ensure counter + blocks does not wrap past 2^32.
+   */
+  static void xorStreamIetf(const uint8_t* data, size_t length, const uint8_t* key,
+                            const uint8_t* nonce, uint32_t counter, uint8_t* cipher, int rounds);
+
+private:
+  /**
+   * Run chunkFn(offset, len) over CHUNK_SIZE slices, on the pool above PARALLEL_THRESHOLD
+   */
+  template <typename ChunkFn>
+  static void forEachChunk(size_t length, ChunkFn&& chunkFn);
+};
+
+} // namespace margelo::nitro::concealcrypto
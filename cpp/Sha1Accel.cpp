@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Sha1Accel.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHA1_ACCEL_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define SHA1_ACCEL_ARM 1
+#include <arm_neon.h>
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+namespace margelo::nitro::concealcrypto {
+
+#if defined(SHA1_ACCEL_X86)
+
+// One group of 4 rounds using message word vector `cur`, updating the schedule
+// for the following groups (sha1msg1 / xor / sha1msg2 pipeline).
+#define SHA1_NI_GROUP(ECUR, EOTHER, CUR, NEXT, PREV2, PREV3, FUNC) \
+  ECUR = _mm_sha1nexte_epu32(ECUR, CUR);                          \
+  EOTHER = abcd;                                                  \
+  NEXT = _mm_sha1msg2_epu32(NEXT, CUR);                           \
+  abcd = _mm_sha1rnds4_epu32(abcd, ECUR, FUNC);                   \
+  PREV3 = _mm_sha1msg1_epu32(PREV3, CUR);                         \
+  PREV2 = _mm_xor_si128(PREV2, CUR);
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha1CompressShaNi(uint32_t h[5], const uint8_t* blocks, size_t count) {
+  const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+  __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(h)), 0x1B);
+  __m128i e0 = _mm_set_epi32(static_cast<int>(h[4]), 0, 0, 0);
+  __m128i e1;
+
+  for (; count > 0; count--, blocks += 64) {
+    const __m128i abcdSave = abcd;
+    const __m128i e0Save = e0;
+
+    __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 0)), mask);
+    __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 16)), mask);
+    __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 32)), mask);
+    __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 48)), mask);
+
+    // Rounds 0-11: schedule pipeline is still filling
+    e0 = _mm_add_epi32(e0, msg0);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+    e1 = _mm_sha1nexte_epu32(e1, msg1);
+    e0 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+    e0 = _mm_sha1nexte_epu32(e0, msg2);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+
+    // Rounds 12-79
+    SHA1_NI_GROUP(e1, e0, msg3, msg0, msg1, msg2, 0)
+    SHA1_NI_GROUP(e0, e1, msg0, msg1, msg2, msg3, 0)
+    SHA1_NI_GROUP(e1, e0, msg1, msg2, msg3, msg0, 1)
+    SHA1_NI_GROUP(e0, e1, msg2, msg3, msg0, msg1, 1)
+    SHA1_NI_GROUP(e1, e0, msg3, msg0, msg1, msg2, 1)
+    SHA1_NI_GROUP(e0, e1, msg0, msg1, msg2, msg3, 1)
+    SHA1_NI_GROUP(e1, e0, msg1, msg2, msg3, msg0, 1)
+    SHA1_NI_GROUP(e0, e1, msg2, msg3, msg0, msg1, 2)
+    SHA1_NI_GROUP(e1, e0, msg3, msg0, msg1, msg2, 2)
+    SHA1_NI_GROUP(e0, e1, msg0, msg1, msg2, msg3, 2)
+    SHA1_NI_GROUP(e1, e0, msg1, msg2, msg3, msg0, 2)
+    SHA1_NI_GROUP(e0, e1, msg2, msg3, msg0, msg1, 2)
+    SHA1_NI_GROUP(e1, e0, msg3, msg0, msg1, msg2, 3)
+    SHA1_NI_GROUP(e0, e1, msg0, msg1, msg2, msg3, 3)
+    SHA1_NI_GROUP(e1, e0, msg1, msg2, msg3, msg0, 3)
+    SHA1_NI_GROUP(e0, e1, msg2, msg3, msg0, msg1, 3)
+    SHA1_NI_GROUP(e1, e0, msg3, msg0, msg1, msg2, 3)
+
+    // Combine state
+    e0 = _mm_sha1nexte_epu32(e0, e0Save);
+    abcd = _mm_add_epi32(abcd, abcdSave);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(h), _mm_shuffle_epi32(abcd, 0x1B));
+  h[4] = static_cast<uint32_t>(_mm_extract_epi32(e0, 3));
+}
+
+#undef SHA1_NI_GROUP
+
+static bool cpuHasShaNi() noexcept {
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+  const bool ssse3 = (ecx & (1u << 9)) != 0;
+  const bool sse41 = (ecx & (1u << 19)) != 0;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+  const bool sha = (ebx & (1u << 29)) != 0;
+  return ssse3 && sse41 && sha;
+}
+
+Sha1CompressFn sha1HardwareCompress() noexcept {
+  return cpuHasShaNi() ? &sha1CompressShaNi : nullptr;
+}
+
+#elif defined(SHA1_ACCEL_ARM)
+
+#if defined(__clang__)
+#define SHA1_ARM_TARGET __attribute__((target("crypto")))
+#else
+#define SHA1_ARM_TARGET __attribute__((target("+crypto")))
+#endif
+
+// W(j) = su1(su0(W(j-4), W(j-3), W(j-2)), W(j-1)) for message groups j >= 4
+#define SHA1_ARM_SCHEDULE(W, j) \
+  W[(j) & 3] = vsha1su1q_u32(vsha1su0q_u32(W[(j) & 3], W[((j) + 1) & 3], W[((j) + 2) & 3]), W[((j) + 3) & 3])
+
+SHA1_ARM_TARGET
+static void sha1CompressArm(uint32_t h[5], const uint8_t* blocks, size_t count) {
+  const uint32x4_t k0 = vdupq_n_u32(0x5A827999);
+  const uint32x4_t k1 = vdupq_n_u32(0x6ED9EBA1);
+  const uint32x4_t k2 = vdupq_n_u32(0x8F1BBCDC);
+  const uint32x4_t k3 = vdupq_n_u32(0xCA62C1D6);
+
+  uint32x4_t abcd = vld1q_u32(h);
+  uint32_t e = h[4];
+
+  for (; count > 0; count--, blocks += 64) {
+    const uint32x4_t abcdSave = abcd;
+    const uint32_t eSave = e;
+    uint32x4_t w[4];
+    uint32_t eNext;
+
+    for (int i = 0; i < 4; i++) {
+      w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(blocks + i * 16)));
+    }
+
+    // Rounds 0-19: Ch
+    for (int j = 0; j < 5; j++) {
+      if (j == 4) SHA1_ARM_SCHEDULE(w, j);
+      eNext = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1cq_u32(abcd, e, vaddq_u32(w[j & 3], k0));
+      e = eNext;
+    }
+    // Rounds 20-39: Parity
+    for (int j = 5; j < 10; j++) {
+      SHA1_ARM_SCHEDULE(w, j);
+      eNext = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e, vaddq_u32(w[j & 3], k1));
+      e = eNext;
+    }
+    // Rounds 40-59: Maj
+    for (int j = 10; j < 15; j++) {
+      SHA1_ARM_SCHEDULE(w, j);
+      eNext = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1mq_u32(abcd, e, vaddq_u32(w[j & 3], k2));
+      e = eNext;
+    }
+    // Rounds 60-79: Parity
+    for (int j = 15; j < 20; j++) {
+      SHA1_ARM_SCHEDULE(w, j);
+      eNext = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      abcd = vsha1pq_u32(abcd, e, vaddq_u32(w[j & 3], k3));
+      e = eNext;
+    }
+
+    abcd = vaddq_u32(abcd, abcdSave);
+    e += eSave;
+  }
+
+  vst1q_u32(h, abcd);
+  h[4] = e;
+}
+
+#undef SHA1_ARM_SCHEDULE
+
+Sha1CompressFn sha1HardwareCompress() noexcept {
+#if defined(__APPLE__)
+  // Every arm64 Apple CPU implements the ARMv8 SHA1 instructions
+  return &sha1CompressArm;
+#elif defined(HWCAP_SHA1)
+  return (getauxval(AT_HWCAP) & HWCAP_SHA1) ? &sha1CompressArm : nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+#else
+
+Sha1CompressFn sha1HardwareCompress() noexcept {
+  return nullptr;
+}
+
+#endif
+
+} // namespace margelo::nitro::concealcrypto
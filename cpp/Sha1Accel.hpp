@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * SHA-1 compression over `count` consecutive 64-byte blocks
+ */
+using Sha1CompressFn = void (*)(uint32_t h[5], const uint8_t* blocks, size_t count);
+
+/**
+ * Hardware SHA-1 compression for the running CPU, selected at runtime:
+ * x86 SHA-NI (cpuid) or ARMv8 SHA1 instructions (HWCAP / Apple arm64).
+ * @return Accelerated implementation, or nullptr if the CPU has none
+ */
+Sha1CompressFn sha1HardwareCompress() noexcept;
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+// Identity of the current thread inside a pool, and the class of the task it runs
+static thread_local const ThreadPool* t_pool = nullptr;
+static thread_local size_t t_index = 0;
+static thread_local TaskPriority t_priority = TaskPriority::Normal;
+
+ThreadPool& ThreadPool::shared() {
+  // Leave one core for the JS thread, which joins the work in parallelFor(), but
+  // keep at least one worker so the *Async methods never run on the JS thread
+  // (hardware_concurrency() may also report 0 when unknown)
+  static ThreadPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+  return pool;
+}
+
+ThreadPool::ThreadPool(size_t threadCount) {
+  start(std::min(threadCount, MAX_THREADS));
+}
+
+ThreadPool::~ThreadPool() {
+  stop();
+}
+
+size_t ThreadPool::size() const {
+  std::shared_lock<std::shared_mutex> lock(_workersMutex);
+  return _workers.size();
+}
+
+void ThreadPool::start(size_t threadCount) {
+  std::unique_lock<std::shared_mutex> lock(_workersMutex);
+  _workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++) {
+    _workers.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < threadCount; i++) {
+    _workers[i]->thread = std::thread([this, i] { workerLoop(i); });
+  }
+}
+
+void ThreadPool::stop() {
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _stopping = true;
+  }
+  _cv.notify_all();
+  // _workers only changes under _resizeMutex, which the callers hold (or no one can race the destructor)
+  for (auto& worker : _workers) {
+    if (worker->thread.joinable()) worker->thread.join();
+  }
+}
+
+void ThreadPool::resize(size_t threadCount) {
+  if (threadCount > MAX_THREADS) {
+    throw std::invalid_argument("Thread count must be between 0 and " + std::to_string(MAX_THREADS));
+  }
+  if (t_pool == this) {
+    throw std::runtime_error("ThreadPool cannot be resized from one of its own workers");
+  }
+  std::lock_guard<std::mutex> resizeLock(_resizeMutex);
+  stop();
+
+  std::vector<std::function<void()>> orphans;
+  {
+    std::unique_lock<std::shared_mutex> lock(_workersMutex);
+    std::vector<std::unique_ptr<Worker>> old = std::move(_workers);
+    _workers.clear();
+    for (size_t i = 0; i < threadCount; i++) {
+      _workers.push_back(std::make_unique<Worker>());
+    }
+
+    // Hand queued work to the new workers, or run it below if there are none
+    size_t next = 0;
+    for (auto& worker : old) {
+      for (size_t p = 0; p < PRIORITY_COUNT; p++) {
+        for (auto& task : worker->queues[p]) {
+          if (threadCount > 0) {
+            _workers[next++ % threadCount]->queues[p].push_back(std::move(task));
+          } else {
+            _depth[p].fetch_sub(1);
+            orphans.push_back(std::move(task));
+          }
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> sleepLock(_sleepMutex);
+    _pending -= static_cast<std::ptrdiff_t>(orphans.size());
+    _stopping = false;
+    for (size_t i = 0; i < threadCount; i++) {
+      _workers[i]->thread = std::thread([this, i] { workerLoop(i); });
+    }
+  }
+
+  for (auto& task : orphans) {
+    task();
+  }
+}
+
+bool ThreadPool::take(size_t index, std::function<void()>& task, TaskPriority& priority) {
+  size_t count = _workers.size();
+  for (size_t p = 0; p < PRIORITY_COUNT; p++) {
+    if (_depth[p].load() == 0) continue;
+    // Own deque first (newest task, warm cache), then the oldest task of each other worker
+    for (size_t k = 0; k < count; k++) {
+      Worker& worker = *_workers[(index + k) % count];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      auto& queue = worker.queues[p];
+      if (queue.empty()) continue;
+      if (k == 0) {
+        task = std::move(queue.back());
+        queue.pop_back();
+      } else {
+        task = std::move(queue.front());
+        queue.pop_front();
+        _steals.fetch_add(1, std::memory_order_relaxed);
+      }
+      _depth[p].fetch_sub(1);
+      priority = static_cast<TaskPriority>(p);
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+  t_pool = this;
+  t_index = index;
+  for (;;) {
+    std::function<void()> task;
+    TaskPriority priority = TaskPriority::Normal;
+    bool found;
+    {
+      std::shared_lock<std::shared_mutex> lock(_workersMutex);
+      found = take(index, task, priority);
+    }
+
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    if (_stopping) {
+      if (!found) return;
+      // Put it back for the next set of workers
+      lock.unlock();
+      std::shared_lock<std::shared_mutex> workersLock(_workersMutex);
+      Worker& worker = *_workers[index];
+      std::lock_guard<std::mutex> queueLock(worker.mutex);
+      worker.queues[static_cast<size_t>(priority)].push_front(std::move(task));
+      _depth[static_cast<size_t>(priority)].fetch_add(1);
+      return;
+    }
+    if (!found) {
+      _cv.wait(lock, [this] { return _stopping || _pending > 0; });
+      continue;
+    }
+    _pending--;
+    lock.unlock();
+
+    t_priority = priority;
+    task();
+    t_priority = TaskPriority::Normal;
+    _executed.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void ThreadPool::submit(std::function<void()> task, TaskPriority priority) {
+  size_t p = static_cast<size_t>(priority);
+  {
+    std::shared_lock<std::shared_mutex> lock(_workersMutex);
+    if (!_workers.empty()) {
+      // Workers keep follow-up work local (run newest first); outside callers spread
+      // it round-robin at the far end, so the owner runs those oldest first
+      bool local = t_pool == this;
+      size_t index = local ? t_index : _nextWorker.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+      {
+        std::lock_guard<std::mutex> queueLock(_workers[index]->mutex);
+        auto& queue = _workers[index]->queues[p];
+        if (local) {
+          queue.push_back(std::move(task));
+        } else {
+          queue.push_front(std::move(task));
+        }
+        _depth[p].fetch_add(1);
+      }
+      {
+        std::lock_guard<std::mutex> sleepLock(_sleepMutex);
+        _pending++;
+      }
+      _cv.notify_one();
+      return;
+    }
+  }
+  task();
+}
+
+ThreadPoolCounters ThreadPool::counters() const {
+  ThreadPoolCounters counters;
+  counters.threads = size();
+  for (size_t p = 0; p < PRIORITY_COUNT; p++) {
+    counters.queueDepth[p] = _depth[p].load();
+  }
+  counters.steals = _steals.load(std::memory_order_relaxed);
+  counters.executed = _executed.load(std::memory_order_relaxed);
+  return counters;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+  if (count == 0) return;
+
+  // Shared between the caller and helper tasks; helpers may outlive this frame
+  // only until they observe that all indices are claimed.
+  struct Job {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    size_t count = 0;
+    const std::function<void(size_t)>* fn = nullptr;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto job = std::make_shared<Job>();
+  job->count = count;
+  job->fn = &fn;
+
+  auto drain = [](Job& j) {
+    size_t i;
+    while ((i = j.next.fetch_add(1)) < j.count) {
+      try {
+        (*j.fn)(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(j.mutex);
+        if (!j.error) j.error = std::current_exception();
+      }
+      if (j.done.fetch_add(1) + 1 == j.count) {
+        std::lock_guard<std::mutex> lock(j.mutex);
+        j.finished.notify_all();
+      }
+    }
+  };
+
+  size_t helpers = std::min(count - 1, size());
+  for (size_t h = 0; h < helpers; h++) {
+    submit([job, drain] { drain(*job); }, t_priority);
+  }
+
+  drain(*job);
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->finished.wait(lock, [&] { return job->done.load() == job->count; });
+  if (job->error) std::rethrow_exception(job->error);
+}
+
+} // namespace margelo::nitro::concealcrypto
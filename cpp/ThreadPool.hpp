@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Scheduling class of a pool task. Workers always take the highest class
+ * queued anywhere in the pool first; running tasks are never interrupted.
+ */
+enum class TaskPriority : uint8_t {
+  High = 0,    // interactive work, e.g. signing a transaction the user is waiting on
+  Normal = 1,  // default for single calls
+  Low = 2,     // background batches, e.g. wallet sync
+};
+
+/**
+ * Snapshot of the pool counters
+ */
+struct ThreadPoolCounters {
+  size_t threads = 0;
+  std::array<size_t, 3> queueDepth{};  // queued tasks per TaskPriority
+  uint64_t steals = 0;                 // tasks taken from another worker's deque
+  uint64_t executed = 0;               // tasks run by workers
+};
+
+/**
+ * Work-stealing native worker pool shared by the data-parallel crypto paths
+ * (e.g. chunked ChaCha over large buffers) and the Promise-returning methods.
+ * Each worker owns one deque per priority: it pushes and pops its own work at
+ * the back, idle workers steal from the front of the others. Tasks submitted
+ * from outside the pool are spread round-robin over the workers and queued at
+ * the front, so each worker runs them in submission order.
+ */
+class ThreadPool {
+public:
+  static constexpr size_t PRIORITY_COUNT = 3;
+  static constexpr size_t MAX_THREADS = 64;
+
+  /**
+   * Process-wide pool, by default sized from std::thread::hardware_concurrency()
+   * minus one for the JS thread, with at least one worker
+   */
+  static ThreadPool& shared();
+
+  explicit ThreadPool(size_t threadCount);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * Number of worker threads
+   */
+  size_t size() const;
+
+  /**
+   * Replace the workers with threadCount new ones; queued tasks are kept.
+   * Waits for the running tasks to finish.
+   * @param threadCount New worker count (0 runs submitted tasks inline)
+   * @throws std::invalid_argument if threadCount exceeds MAX_THREADS
+   * @throws std::runtime_error if called from a pool worker
+   */
+  void resize(size_t threadCount);
+
+  /**
+   * Run fn(i) for every i in [0, count) and block until all calls returned.
+   * The calling thread takes part in the work, so this never deadlocks when
+   * the pool is saturated. Helpers inherit the priority of the calling task
+   * (Normal outside the pool). The first exception thrown by fn is rethrown.
+   * @param count Number of independent work items
+   * @param fn Work item callback
+   */
+  void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+  /**
+   * Queue a task without waiting for it (backs the *Async methods).
+   * The task must not throw. Runs inline when the pool has no workers.
+   * @param task Work to run on a pool thread
+   * @param priority Scheduling class
+   */
+  void submit(std::function<void()> task, TaskPriority priority = TaskPriority::Normal);
+
+  /**
+   * Current thread count, queue depths and steal / execution counters
+   */
+  ThreadPoolCounters counters() const;
+
+private:
+  struct Worker {
+    std::mutex mutex;
+    std::array<std::deque<std::function<void()>>, PRIORITY_COUNT> queues;
+    std::thread thread;
+  };
+
+  void start(size_t threadCount);
+  void stop();
+  void workerLoop(size_t index);
+  bool take(size_t index, std::function<void()>& task, TaskPriority& priority);
+
+  // Guards _workers: shared for queue access, exclusive while resizing
+  mutable std::shared_mutex _workersMutex;
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::mutex _resizeMutex;
+
+  // Sleeping workers wait for _pending > 0
+  std::mutex _sleepMutex;
+  std::condition_variable _cv;
+  std::ptrdiff_t _pending = 0;  // may dip below 0 while a push races its pop
+  bool _stopping = false;
+
+  std::array<std::atomic<size_t>, PRIORITY_COUNT> _depth{};
+  std::atomic<size_t> _nextWorker{0};
+  std::atomic<uint64_t> _steals{0};
+  std::atomic<uint64_t> _executed{0};
+};
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#include "Transaction.hpp"
+#include "HexCodec.hpp"
+#include "Cryptonote/Varint.h"
+
+extern "C" {
+  void cn_fast_hash(const void *data, size_t length, char *hash);
+}
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+// Largest integer a JS number holds exactly
+static constexpr uint64_t MAX_SAFE_INTEGER = (uint64_t(1) << 53) - 1;
+
+namespace {
+
+// Bounds-checked cursor over the blob
+class Reader {
+public:
+  Reader(const uint8_t* data, size_t length) : _begin(data), _it(data), _end(data + length) {}
+
+  size_t position() const { return static_cast<size_t>(_it - _begin); }
+  size_t remaining() const { return static_cast<size_t>(_end - _it); }
+  bool atEnd() const { return _it == _end; }
+
+  uint8_t byte(const char* field) {
+    if (_it == _end) fail(field);
+    return *_it++;
+  }
+
+  // Rejects truncated, overlong and non-canonical encodings
+  bool tryVarint(uint64_t& value) {
+    const uint8_t* start = _it;
+    if (tools::read_varint(_it, _end, value) <= 0 || (_it[-1] & 0x80) != 0) {
+      _it = start;
+      return false;
+    }
+    return true;
+  }
+
+  uint64_t varint(const char* field) {
+    uint64_t value;
+    if (!tryVarint(value)) fail(field);
+    return value;
+  }
+
+  // Varint that is returned to JS as a number
+  double number(const char* field) {
+    uint64_t value = varint(field);
+    if (value > MAX_SAFE_INTEGER) fail(field);
+    return static_cast<double>(value);
+  }
+
+  // Element count: each element takes at least one byte, so anything larger is corrupt
+  size_t count(const char* field) {
+    uint64_t value = varint(field);
+    if (value > remaining()) fail(field);
+    return static_cast<size_t>(value);
+  }
+
+  size_t skip(size_t size, const char* field) {
+    if (size > remaining()) fail(field);
+    size_t offset = position();
+    _it += size;
+    return offset;
+  }
+
+  [[noreturn]] void fail(const char* field) const {
+    throw std::invalid_argument(std::string("Invalid transaction: bad ") + field + " at offset " + std::to_string(position()));
+  }
+
+private:
+  const uint8_t* _begin;
+  const uint8_t* _it;
+  const uint8_t* _end;
+};
+
+} // namespace
+
+// Find the first tx public key in extra. Extra is not validated by consensus, so a
+// malformed or unknown field just ends the scan (like the node's own parser).
+static double findPublicKey(const uint8_t* data, size_t offset, size_t length) {
+  Reader extra(data + offset, length);
+  while (!extra.atEnd()) {
+    uint64_t size;
+    switch (extra.byte("extra tag")) {
+      case Transaction::EXTRA_PADDING:
+        // Zero padding runs to the end of extra
+        return -1;
+      case Transaction::EXTRA_PUBKEY:
+        if (extra.remaining() < Transaction::KEY_SIZE) return -1;
+        return static_cast<double>(offset + extra.position());
+      case Transaction::EXTRA_NONCE:
+        // Single length byte
+        if (extra.atEnd()) return -1;
+        size = extra.byte("extra nonce size");
+        break;
+      case Transaction::EXTRA_MERGE_MINING:
+      case Transaction::EXTRA_MESSAGE:
+      case Transaction::EXTRA_TTL:
+        if (!extra.tryVarint(size)) return -1;
+        break;
+      default:
+        return -1;
+    }
+    if (size > extra.remaining()) return -1;
+    extra.skip(static_cast<size_t>(size), "extra field");
+  }
+  return -1;
+}
+
+ParsedTransaction Transaction::parse(const uint8_t* data, size_t length) {
+  Reader reader(data, length);
+  ParsedTransaction tx;
+
+  tx.version = reader.number("version");
+  tx.unlockTime = reader.number("unlockTime");
+
+  // Inputs
+  size_t signatureCount = 0;
+  size_t inputCount = reader.count("input count");
+  tx.inputs.reserve(inputCount);
+  for (size_t i = 0; i < inputCount; i++) {
+    TransactionInputInfo input;
+    input.offset = static_cast<double>(reader.position());
+    input.type = reader.byte("input type");
+    input.amount = 0;
+    input.ringSize = 0;
+    input.keyImageOffset = -1;
+
+    switch (static_cast<uint8_t>(input.type)) {
+      case INPUT_BASE:
+        reader.varint("block index");
+        break;
+      case INPUT_KEY: {
+        input.amount = reader.number("input amount");
+        size_t ringSize = reader.count("output index count");
+        for (size_t k = 0; k < ringSize; k++) reader.varint("output index");
+        input.ringSize = static_cast<double>(ringSize);
+        input.keyImageOffset = static_cast<double>(reader.skip(KEY_SIZE, "key image"));
+        signatureCount += ringSize;
+        break;
+      }
+      case INPUT_MULTISIGNATURE: {
+        input.amount = reader.number("input amount");
+        uint64_t signatures = reader.varint("signature count");
+        reader.varint("output index");
+        reader.varint("term");
+        if (signatures > UINT8_MAX) reader.fail("signature count");
+        input.ringSize = static_cast<double>(signatures);
+        signatureCount += static_cast<size_t>(signatures);
+        break;
+      }
+      default:
+        reader.fail("input type");
+    }
+    input.length = static_cast<double>(reader.position()) - input.offset;
+    tx.inputs.push_back(input);
+  }
+
+  // Outputs
+  size_t outputCount = reader.count("output count");
+  tx.outputs.reserve(outputCount);
+  for (size_t i = 0; i < outputCount; i++) {
+    TransactionOutputInfo output;
+    output.offset = static_cast<double>(reader.position());
+    output.amount = reader.number("output amount");
+    output.type = reader.byte("output type");
+
+    switch (static_cast<uint8_t>(output.type)) {
+      case OUTPUT_KEY:
+        output.keyCount = 1;
+        output.keyOffset = static_cast<double>(reader.skip(KEY_SIZE, "output key"));
+        break;
+      case OUTPUT_MULTISIGNATURE: {
+        size_t keyCount = reader.count("output key count");
+        output.keyCount = static_cast<double>(keyCount);
+        if (keyCount > reader.remaining() / KEY_SIZE) reader.fail("output key count");
+        output.keyOffset = static_cast<double>(reader.skip(keyCount * KEY_SIZE, "output keys"));
+        reader.varint("required signature count");
+        reader.varint("term");
+        break;
+      }
+      default:
+        reader.fail("output type");
+    }
+    output.length = static_cast<double>(reader.position()) - output.offset;
+    tx.outputs.push_back(output);
+  }
+
+  // Extra
+  size_t extraLength = reader.count("extra size");
+  size_t extraOffset = reader.skip(extraLength, "extra");
+  tx.extraOffset = static_cast<double>(extraOffset);
+  tx.extraLength = static_cast<double>(extraLength);
+  tx.publicKeyOffset = findPublicKey(data, extraOffset, extraLength);
+  if (tx.publicKeyOffset >= 0) {
+    tx.publicKey = HexCodec::encode(data + static_cast<size_t>(tx.publicKeyOffset), KEY_SIZE);
+  }
+  tx.prefixLength = static_cast<double>(reader.position());
+
+  // Signatures: absent for a bare prefix, otherwise exactly one per ring member
+  tx.signaturesOffset = static_cast<double>(reader.position());
+  tx.signaturesLength = static_cast<double>(reader.remaining());
+  if (!reader.atEnd() && (signatureCount > reader.remaining() / SIGNATURE_SIZE ||
+                          reader.remaining() != signatureCount * SIGNATURE_SIZE)) {
+    reader.fail("signatures size");
+  }
+
+  return tx;
+}
+
+// ---------------------------------------------------------------------------
+// Serialization
+// ---------------------------------------------------------------------------
+
+namespace {
+
+// Growing output buffer
+class Writer {
+public:
+  explicit Writer(size_t capacity) { _data.reserve(capacity); }
+
+  void byte(uint8_t value) { _data.push_back(value); }
+
+  // JS numbers must be non-negative integers to become varints
+  void varint(double value, const char* field) {
+    if (!(value >= 0) || value > static_cast<double>(MAX_SAFE_INTEGER) ||
+        static_cast<double>(static_cast<uint64_t>(value)) != value) {
+      throw std::invalid_argument(std::string("Invalid transaction ") + field + ": must be a non-negative safe integer");
+    }
+    tools::write_varint(std::back_inserter(_data), static_cast<uint64_t>(value));
+  }
+
+  void varint(const std::optional<double>& value, const char* field) {
+    if (!value.has_value()) {
+      throw std::invalid_argument(std::string("Invalid transaction: missing ") + field);
+    }
+    varint(*value, field);
+  }
+
+  void bytes(const uint8_t* data, size_t length) { _data.insert(_data.end(), data, data + length); }
+
+  std::vector<uint8_t>& data() { return _data; }
+
+private:
+  std::vector<uint8_t> _data;
+};
+
+} // namespace
+
+static const uint8_t* keyBuffer(const std::shared_ptr<ArrayBuffer>& buffer, size_t count, const char* field) {
+  if (!buffer || buffer->size() != count * Transaction::KEY_SIZE) {
+    throw std::invalid_argument(std::string("Invalid transaction ") + field + ": wrong size");
+  }
+  return buffer->data();
+}
+
+SerializedTransactionPrefix Transaction::serializePrefix(const TransactionPrefix& prefix) {
+  // Typical key input ~ 50 bytes + indexes, key output ~ 40 bytes
+  size_t extraSize = prefix.extra ? prefix.extra->size() : 0;
+  Writer writer(16 + prefix.inputs.size() * 64 + prefix.outputs.size() * 48 + extraSize);
+
+  writer.varint(prefix.version, "version");
+  writer.varint(prefix.unlockTime, "unlockTime");
+
+  writer.varint(static_cast<double>(prefix.inputs.size()), "input count");
+  for (const auto& input : prefix.inputs) {
+    switch (static_cast<int>(input.type)) {
+      case INPUT_BASE:
+        writer.byte(INPUT_BASE);
+        writer.varint(input.blockIndex, "blockIndex");
+        break;
+      case INPUT_KEY: {
+        if (!input.outputIndexes.has_value() || !input.keyImage.has_value()) {
+          throw std::invalid_argument("Invalid transaction: key input needs outputIndexes and keyImage");
+        }
+        writer.byte(INPUT_KEY);
+        writer.varint(input.amount, "input amount");
+        writer.varint(static_cast<double>(input.outputIndexes->size()), "output index count");
+        for (double index : *input.outputIndexes) writer.varint(index, "output index");
+        writer.bytes(keyBuffer(*input.keyImage, 1, "keyImage"), KEY_SIZE);
+        break;
+      }
+      case INPUT_MULTISIGNATURE:
+        writer.byte(INPUT_MULTISIGNATURE);
+        writer.varint(input.amount, "input amount");
+        writer.varint(input.signatureCount, "signatureCount");
+        writer.varint(input.outputIndex, "outputIndex");
+        writer.varint(input.term, "term");
+        break;
+      default:
+        throw std::invalid_argument("Invalid transaction: unknown input type " + std::to_string(input.type));
+    }
+  }
+
+  writer.varint(static_cast<double>(prefix.outputs.size()), "output count");
+  for (const auto& output : prefix.outputs) {
+    writer.varint(output.amount, "output amount");
+    switch (static_cast<int>(output.type)) {
+      case OUTPUT_KEY:
+        writer.byte(OUTPUT_KEY);
+        writer.bytes(keyBuffer(output.keys, 1, "output key"), KEY_SIZE);
+        break;
+      case OUTPUT_MULTISIGNATURE: {
+        size_t keyCount = output.keys ? output.keys->size() / KEY_SIZE : 0;
+        const uint8_t* keys = keyBuffer(output.keys, keyCount, "output keys");
+        writer.byte(OUTPUT_MULTISIGNATURE);
+        writer.varint(static_cast<double>(keyCount), "output key count");
+        writer.bytes(keys, keyCount * KEY_SIZE);
+        writer.varint(output.requiredSignatureCount, "requiredSignatureCount");
+        writer.varint(output.term, "term");
+        break;
+      }
+      default:
+        throw std::invalid_argument("Invalid transaction: unknown output type " + std::to_string(output.type));
+    }
+  }
+
+  writer.varint(static_cast<double>(extraSize), "extra size");
+  if (extraSize > 0) writer.bytes(prefix.extra->data(), extraSize);
+
+  auto hash = ArrayBuffer::allocate(32);
+  std::vector<uint8_t>& data = writer.data();
+  cn_fast_hash(data.data(), data.size(), reinterpret_cast<char*>(hash->data()));
+
+  // Hand the buffer to JS as-is
+  auto* owned = new std::vector<uint8_t>(std::move(data));
+  auto blob = ArrayBuffer::wrap(owned->data(), owned->size(), [owned] { delete owned; });
+  return SerializedTransactionPrefix(blob, hash);
+}
+
+} // namespace margelo::nitro::concealcrypto
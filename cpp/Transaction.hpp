@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ * 
+ * This file is part of react-native-conceal-crypto.
+ * 
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include "../nitrogen/generated/shared/c++/ParsedTransaction.hpp"
+#include "../nitrogen/generated/shared/c++/TransactionPrefix.hpp"
+#include "../nitrogen/generated/shared/c++/SerializedTransactionPrefix.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::concealcrypto {
+
+/**
+ * Conceal binary transaction format
+ * Prefix: version, unlockTime, inputs, outputs, extra (all integers as varints),
+ * followed by the ring signatures (64 bytes per ring member of each input).
+ */
+class Transaction {
+public:
+  // Input variant tags
+  static constexpr uint8_t INPUT_BASE = 0xff;
+  static constexpr uint8_t INPUT_KEY = 0x02;
+  static constexpr uint8_t INPUT_MULTISIGNATURE = 0x03;
+
+  // Output target variant tags
+  static constexpr uint8_t OUTPUT_KEY = 0x02;
+  static constexpr uint8_t OUTPUT_MULTISIGNATURE = 0x03;
+
+  // Extra field tags
+  static constexpr uint8_t EXTRA_PADDING = 0x00;
+  static constexpr uint8_t EXTRA_PUBKEY = 0x01;
+  static constexpr uint8_t EXTRA_NONCE = 0x02;
+  static constexpr uint8_t EXTRA_MERGE_MINING = 0x03;
+  static constexpr uint8_t EXTRA_MESSAGE = 0x04;
+  static constexpr uint8_t EXTRA_TTL = 0x05;
+
+  static constexpr size_t KEY_SIZE = 32;
+  static constexpr size_t SIGNATURE_SIZE = 64;
+
+  /**
+   * Parse a transaction (or a bare prefix) in a single pass.
+   * Nothing is copied except the tx public key: every other field is reported as
+   * an offset/length into the input buffer or as a decoded integer.
+   * @param data Transaction blob
+   * @param length Blob size in bytes
+   * @throws std::invalid_argument on truncated, malformed or trailing data
+   */
+  static ParsedTransaction parse(const uint8_t* data, size_t length);
+
+  /**
+   * Serialize a transaction prefix and hash it (cn_fast_hash) in one pass.
+   * Varints are written straight into one growing native buffer that is handed
+   * to JS without a further copy.
+   * @param prefix Structured prefix
+   * @throws std::invalid_argument on missing/ill-sized fields or non-integer values
+   */
+  static SerializedTransactionPrefix serializePrefix(const TransactionPrefix& prefix);
+};
+
+} // namespace margelo::nitro::concealcrypto
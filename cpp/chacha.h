@@ -26,6 +26,13 @@ void chacha_block(uint8_t out[64],
                   uint64_t counter,
                   int rounds);
 
+/* IETF block function (32-bit counter, 12-byte nonce) */
+void chacha_ietf_block(uint8_t out[64],
+                       const uint8_t key[32],
+                       const uint8_t nonce[12],
+                       uint32_t counter,
+                       int rounds);
+
 /* Convenience wrappers for specific variants */
 void chacha8_block(uint8_t out[64],
                    const uint8_t key[32],
@@ -42,9 +49,18 @@ void chacha20_block(uint8_t out[64],
                     const uint8_t nonce[8],
                     uint64_t counter);
 
+/* Stream cipher core: XOR `length` bytes starting at block `counter` */
+void chacha_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv,
+                uint64_t counter, uint8_t *cipher, int rounds);
+void chacha_ietf_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *nonce,
+                     uint32_t counter, uint8_t *cipher, int rounds);
+
 /* Stream cipher functions with modern signatures */
 void chacha8_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher);
 void chacha12_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher);
+void chacha20_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher);
+void chacha20_ietf_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *nonce,
+                       uint32_t counter, uint8_t *cipher);
 
 /* Legacy functions for backward compatibility */
 void chacha8(const void *data, size_t length, const uint8_t *key, const uint8_t *iv, char *cipher);
@@ -0,0 +1,31 @@
+/*
+chacha-merged.c version 20080118
+D. J. Bernstein
+Public domain.
+
+Modified and modularized for ChaCha20 / IETF nonce integration – Acktarius 2025
+*/
+
+#include "chacha.h"
+
+/* Convenience wrapper for ChaCha20 */
+void chacha20_block(uint8_t out[64],
+                    const uint8_t key[32],
+                    const uint8_t nonce[8],
+                    uint64_t counter)
+{
+  chacha_block(out, key, nonce, counter, 20);
+}
+
+/* Stream cipher function with modern signature (8-byte nonce, 64-bit counter from 0) */
+void chacha20_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher)
+{
+  chacha_xor(data, length, key, iv, 0, cipher, 20);
+}
+
+/* RFC 8439 stream cipher function (12-byte nonce, 32-bit initial counter) */
+void chacha20_ietf_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *nonce,
+                       uint32_t counter, uint8_t *cipher)
+{
+  chacha_ietf_xor(data, length, key, nonce, counter, cipher, 20);
+}
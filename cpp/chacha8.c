@@ -40,15 +40,15 @@ Public domain.
 
 static const char sigma[] = "expand 32-byte k";
 
-/* Core block function with configurable rounds */
-void chacha_block(uint8_t out[64],
-                  const uint8_t key[32],
-                  const uint8_t nonce[8],
-                  uint64_t counter,
-                  int rounds)
+/* Shared 16-word core: words 12..15 (counter/nonce) are supplied by the caller,
+ * so the 64-bit-counter and IETF 96-bit-nonce layouts run the same rounds. */
+static void chacha_core(uint8_t out[64],
+                        const uint8_t key[32],
+                        uint32_t j12, uint32_t j13, uint32_t j14, uint32_t j15,
+                        int rounds)
 {
   uint32_t x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15;
-  uint32_t j0, j1, j2, j3, j4, j5, j6, j7, j8, j9, j10, j11, j12, j13, j14, j15;
+  uint32_t j0, j1, j2, j3, j4, j5, j6, j7, j8, j9, j10, j11;
   int i;
 
   j0 = U8TO32_LITTLE(sigma + 0);
@@ -63,10 +63,6 @@ void chacha_block(uint8_t out[64],
   j9 = U8TO32_LITTLE(key + 20);
   j10 = U8TO32_LITTLE(key + 24);
   j11 = U8TO32_LITTLE(key + 28);
-  j12 = (uint32_t)(counter & 0xFFFFFFFF);
-  j13 = (uint32_t)(counter >> 32);
-  j14 = U8TO32_LITTLE(nonce + 0);
-  j15 = U8TO32_LITTLE(nonce + 4);
 
   x0 = j0; x1 = j1; x2 = j2; x3 = j3;
   x4 = j4; x5 = j5; x6 = j6; x7 = j7;
@@ -96,6 +92,32 @@ void chacha_block(uint8_t out[64],
   U32TO8_LITTLE(out + 48, x12); U32TO8_LITTLE(out + 52, x13); U32TO8_LITTLE(out + 56, x14); U32TO8_LITTLE(out + 60, x15);
 }
 
+/* Core block function with configurable rounds (64-bit counter, 8-byte nonce) */
+void chacha_block(uint8_t out[64],
+                  const uint8_t key[32],
+                  const uint8_t nonce[8],
+                  uint64_t counter,
+                  int rounds)
+{
+  chacha_core(out, key,
+              (uint32_t)(counter & 0xFFFFFFFF), (uint32_t)(counter >> 32),
+              U8TO32_LITTLE(nonce + 0), U8TO32_LITTLE(nonce + 4),
+              rounds);
+}
+
+/* IETF block function (RFC 8439 layout: 32-bit counter, 12-byte nonce) */
+void chacha_ietf_block(uint8_t out[64],
+                       const uint8_t key[32],
+                       const uint8_t nonce[12],
+                       uint32_t counter,
+                       int rounds)
+{
+  chacha_core(out, key,
+              counter,
+              U8TO32_LITTLE(nonce + 0), U8TO32_LITTLE(nonce + 4), U8TO32_LITTLE(nonce + 8),
+              rounds);
+}
+
 /* Convenience wrapper for ChaCha8 */
 void chacha8_block(uint8_t out[64],
                    const uint8_t key[32],
@@ -105,12 +127,14 @@ void chacha8_block(uint8_t out[64],
   chacha_block(out, key, nonce, counter, 8);
 }
 
-/* Stream cipher function with modern signature */
-void chacha8_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher)
+/* XOR loop over consecutive keystream blocks. `wide` selects a 64-bit counter
+ * carried into word 13 (original layout) or a 32-bit one (IETF layout). */
+static void chacha_core_xor(const uint8_t *data, size_t length, const uint8_t *key,
+                            uint32_t j12, uint32_t j13, uint32_t j14, uint32_t j15, int wide,
+                            uint8_t *cipher, int rounds)
 {
   uint8_t keystream[64];
   uint8_t tmp[64];
-  uint64_t counter = 0;
   size_t remaining = length;
 
   if (!length)
@@ -120,7 +144,7 @@ void chacha8_xor(const uint8_t *data, size_t length, const uint8_t *key, const u
     size_t block_size = (remaining < 64) ? remaining : 64;
     
     /* Generate keystream block */
-    chacha_block(keystream, key, iv, counter, 8);
+    chacha_core(keystream, key, j12, j13, j14, j15, rounds);
     
     /* XOR with data */
     if (block_size == 64)
@@ -141,13 +165,43 @@ void chacha8_xor(const uint8_t *data, size_t length, const uint8_t *key, const u
       }
     }
     
-    counter++;
+    j12 = PLUSONE(j12);
+    if (wide && !j12)
+      j13 = PLUSONE(j13);
     remaining -= block_size;
     data += block_size;
     cipher += block_size;
   } while (remaining > 0);
 }
 
+/* Stream cipher core starting at an arbitrary block counter.
+ * Blocks are independent, so any 64-byte aligned slice of the stream can be
+ * produced on its own (used by the parallel chunked path). */
+void chacha_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv,
+                uint64_t counter, uint8_t *cipher, int rounds)
+{
+  chacha_core_xor(data, length, key,
+                  (uint32_t)(counter & 0xFFFFFFFF), (uint32_t)(counter >> 32),
+                  U8TO32_LITTLE(iv + 0), U8TO32_LITTLE(iv + 4), 1,
+                  cipher, rounds);
+}
+
+/* IETF stream cipher core (12-byte nonce, 32-bit block counter) */
+void chacha_ietf_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *nonce,
+                     uint32_t counter, uint8_t *cipher, int rounds)
+{
+  chacha_core_xor(data, length, key,
+                  counter,
+                  U8TO32_LITTLE(nonce + 0), U8TO32_LITTLE(nonce + 4), U8TO32_LITTLE(nonce + 8), 0,
+                  cipher, rounds);
+}
+
+/* Stream cipher function with modern signature */
+void chacha8_xor(const uint8_t *data, size_t length, const uint8_t *key, const uint8_t *iv, uint8_t *cipher)
+{
+  chacha_xor(data, length, key, iv, 0, cipher, 8);
+}
+
 /* Legacy function for backward compatibility */
 void chacha8(const void *data, size_t length, const uint8_t *key, const uint8_t *iv, char *cipher)
 {
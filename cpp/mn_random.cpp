@@ -8,10 +8,12 @@
  */
 
 #include "mn_random.h"
-#include <random>
+#include "HexCodec.hpp"
+#include "chacha.h"
+#include <atomic>
+#include <cstring>
 #include <stdexcept>
-#include <sstream>
-#include <iomanip>
+#include <pthread.h>
 
 // Try to include libsodium if available
 #ifdef HAVE_SODIUM_H
@@ -32,28 +34,182 @@ static const SodiumInitializer sodium_initializer;
 #define SODIUM_AVAILABLE 0
 #endif
 
-// Thread-local random device for fallback (initialized once per thread)
-thread_local std::random_device* g_random_device = nullptr;
+#if !SODIUM_AVAILABLE
+#if defined(__APPLE__) || defined(__ANDROID__) || defined(__OpenBSD__) || defined(__FreeBSD__) || defined(__NetBSD__)
+#define MN_RANDOM_ARC4RANDOM 1
+#include <stdlib.h>
+#else
+#define MN_RANDOM_ARC4RANDOM 0
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#if __has_include(<sys/random.h>)
+#include <sys/random.h>
+#define MN_RANDOM_GETRANDOM 1
+#else
+#define MN_RANDOM_GETRANDOM 0
+#endif
+
+/**
+ * Thread-local /dev/urandom handle for kernels without getrandom()
+ * Opened on first use and closed when the thread exits
+ */
+class UrandomFile {
+public:
+    ~UrandomFile() {
+        if (_fd >= 0) close(_fd);
+    }
+
+    void read(uint8_t* out, size_t length) {
+        if (_fd < 0) {
+            _fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+            if (_fd < 0) throw std::runtime_error("mn_random: Cannot open /dev/urandom");
+        }
+        while (length > 0) {
+            ssize_t n = ::read(_fd, out, length);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) throw std::runtime_error("mn_random: Reading /dev/urandom failed");
+            out += n;
+            length -= static_cast<size_t>(n);
+        }
+    }
+
+private:
+    int _fd = -1;
+};
+
+static thread_local UrandomFile g_urandom;
+#endif
+#endif
+
+/**
+ * Fill a buffer from the system entropy source in as few calls as possible
+ * Uses libsodium if available, otherwise arc4random_buf, getrandom() or /dev/urandom
+ */
+static void system_random_bytes(uint8_t* out, size_t length) {
+    #if SODIUM_AVAILABLE
+    // sodium_initializer ensures sodium_init() was called once at startup
+    randombytes_buf(out, length);
+    #elif MN_RANDOM_ARC4RANDOM
+    arc4random_buf(out, length);
+    #else
+    #if MN_RANDOM_GETRANDOM
+    while (length > 0) {
+        ssize_t n = getrandom(out, length, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && errno == ENOSYS) break;
+        if (n <= 0) throw std::runtime_error("mn_random: getrandom failed");
+        out += n;
+        length -= static_cast<size_t>(n);
+    }
+    #endif
+    if (length > 0) g_urandom.read(out, length);
+    #endif
+}
+
+static void secure_zero(void* data, size_t length) {
+    #if SODIUM_AVAILABLE
+    sodium_memzero(data, length);
+    #else
+    volatile uint8_t* p = static_cast<volatile uint8_t*>(data);
+    while (length--) *p++ = 0;
+    #endif
+}
+
+// Bumped in the child after fork() so every inherited generator reseeds
+static std::atomic<uint32_t> g_fork_generation{0};
+
+struct ForkHandler {
+    ForkHandler() {
+        pthread_atfork(nullptr, nullptr, [] { g_fork_generation.fetch_add(1, std::memory_order_relaxed); });
+    }
+};
+static const ForkHandler fork_handler;
 
 /**
- * Initialize thread-local random device if needed
- * This ensures per-thread RNG isolation and avoids race conditions
+ * Buffered per-thread CSPRNG
+ * ChaCha20 keystream with fast key erasure: every refill generates one batch of
+ * blocks, the first 32 bytes replace the key and the rest are handed out (and
+ * wiped as they are consumed), so a later state compromise reveals nothing
+ * about earlier output. The key is replaced from the system source every
+ * MN_RANDOM_RESEED_INTERVAL bytes, and after fork().
  */
-static std::random_device& get_random_device() {
-    if (!g_random_device) {
-        g_random_device = new std::random_device();
-        
-        // Verify the random device has entropy
-        if (g_random_device->entropy() == 0) {
-            throw std::runtime_error("mn_random: Hardware random number generator not available");
+class BufferedRandom {
+public:
+    static constexpr size_t BLOCKS = 16;
+    static constexpr size_t STREAM_SIZE = BLOCKS * CHACHA_BLOCK_SIZE;
+    static constexpr size_t BUFFER_SIZE = STREAM_SIZE - CHACHA_KEY_SIZE;
+
+    ~BufferedRandom() {
+        secure_zero(_key, sizeof(_key));
+        secure_zero(_stream, sizeof(_stream));
+    }
+
+    void fill(uint8_t* out, size_t length) {
+        if (!_seeded || _fork_generation != g_fork_generation.load(std::memory_order_relaxed) ||
+            _since_reseed >= MN_RANDOM_RESEED_INTERVAL) {
+            reseed();
+        }
+        _since_reseed += length;
+
+        while (length > 0) {
+            if (_available == 0) refill();
+            size_t take = length < _available ? length : _available;
+            uint8_t* src = _stream + STREAM_SIZE - _available;
+            std::memcpy(out, src, take);
+            secure_zero(src, take);
+            out += take;
+            length -= take;
+            _available -= take;
+        }
+    }
+
+private:
+    void reseed() {
+        system_random_bytes(_key, sizeof(_key));
+        secure_zero(_stream, sizeof(_stream));
+        _available = 0;
+        _since_reseed = 0;
+        _fork_generation = g_fork_generation.load(std::memory_order_relaxed);
+        _seeded = true;
+        _reseeds++;
+    }
+
+    void refill() {
+        static constexpr uint8_t nonce[CHACHA_IV_SIZE] = {0};
+        for (size_t i = 0; i < BLOCKS; i++) {
+            chacha20_block(_stream + i * CHACHA_BLOCK_SIZE, _key, nonce, i);
         }
+        std::memcpy(_key, _stream, CHACHA_KEY_SIZE);
+        secure_zero(_stream, CHACHA_KEY_SIZE);
+        _available = BUFFER_SIZE;
     }
-    return *g_random_device;
+
+    uint8_t _key[CHACHA_KEY_SIZE];
+    uint8_t _stream[STREAM_SIZE];
+    size_t _available = 0;
+    uint64_t _since_reseed = 0;
+    uint64_t _reseeds = 0;
+    uint32_t _fork_generation = 0;
+    bool _seeded = false;
+
+public:
+    uint64_t reseeds() const { return _reseeds; }
+};
+
+static thread_local BufferedRandom g_buffered_random;
+
+void mn_random_fill(uint8_t* out, size_t length) {
+    g_buffered_random.fill(out, length);
+}
+
+uint64_t mn_random_reseed_count() {
+    return g_buffered_random.reseeds();
 }
 
 /**
  * Production-ready secure random number generator
- * Uses libsodium if available, otherwise falls back to hardware RNG
+ * Served from the per-thread buffered generator
  */
 std::string mn_random(int bits) {
     if (bits % 32 != 0) {
@@ -63,29 +219,12 @@ std::string mn_random(int bits) {
     
     const int byteLength = bits / 8;
     std::vector<uint8_t> buffer(byteLength);
-    
-    #if SODIUM_AVAILABLE
-    // Use libsodium for maximum security (preferred)
-    // sodium_initializer ensures sodium_init() was called once at startup
-    randombytes_buf(buffer.data(), buffer.size());
-    #else
-    // Fallback to hardware random device
-    std::random_device& rd = get_random_device();
-    
-    for (int i = 0; i < byteLength; ++i) {
-        buffer[i] = static_cast<uint8_t>(rd());
-    }
-    #endif
+    mn_random_fill(buffer.data(), buffer.size());
     
     // Convert to hex string
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    
-    for (auto b : buffer) {
-        oss << std::setw(2) << static_cast<int>(b);
-    }
-    
-    return oss.str();
+    std::string hex = margelo::nitro::concealcrypto::HexCodec::encode(buffer.data(), buffer.size());
+    secure_zero(buffer.data(), buffer.size());
+    return hex;
 }
 
 /**
@@ -97,19 +236,6 @@ std::vector<uint8_t> mn_random_bytes(int bytes) {
     }
     
     std::vector<uint8_t> buffer(bytes);
-    
-    #if SODIUM_AVAILABLE
-    // Use libsodium for maximum security (preferred)
-    // sodium_initializer ensures sodium_init() was called once at startup
-    randombytes_buf(buffer.data(), buffer.size());
-    #else
-    // Fallback to hardware random device
-    std::random_device& rd = get_random_device();
-    
-    for (int i = 0; i < bytes; ++i) {
-        buffer[i] = static_cast<uint8_t>(rd());
-    }
-    #endif
-    
+    mn_random_fill(buffer.data(), buffer.size());
     return buffer;
 }
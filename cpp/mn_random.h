@@ -13,6 +13,13 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
+
+/**
+ * Bytes served by a thread's buffered generator before its ChaCha20 key is
+ * replaced from the system entropy source
+ */
+#define MN_RANDOM_RESEED_INTERVAL (1024 * 1024)
 
 /**
  * Generate cryptographically secure random data in multiples of 32 bits
@@ -33,4 +40,21 @@ std::string mn_random(int bits);
  */
 std::vector<uint8_t> mn_random_bytes(int bytes);
 
+/**
+ * Fill a buffer from the calling thread's buffered CSPRNG
+ * ChaCha20 with fast key erasure, seeded from libsodium (or arc4random_buf /
+ * getrandom() / /dev/urandom without it) and reseeded every
+ * MN_RANDOM_RESEED_INTERVAL bytes and after fork()
+ * @param out Output buffer
+ * @param length Number of bytes to write
+ * @throws std::runtime_error if the system entropy source is unavailable
+ */
+void mn_random_fill(uint8_t* out, size_t length);
+
+/**
+ * Number of times the calling thread's generator has been (re)seeded
+ * Diagnostics only, used by the native tests
+ */
+uint64_t mn_random_reseed_count();
+
 #endif /* MN_RANDOM_H */
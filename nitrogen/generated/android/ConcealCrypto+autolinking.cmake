@@ -35,6 +35,10 @@ target_sources(
   # Shared Nitrogen C++ sources
   ../nitrogen/generated/shared/c++/HybridConcealCryptoSpec.cpp
   ../nitrogen/generated/shared/c++/HybridCryptonoteSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridHmacKeySpec.cpp
+  ../nitrogen/generated/shared/c++/HybridSecretKeyHandleSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridSecretStreamPullSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridSecretStreamPushSpec.cpp
   # Android-specific Nitrogen C++ sources
   
 )
@@ -0,0 +1,75 @@
+///
+/// DecodedAddress.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DecodedAddress).
+   */
+  struct DecodedAddress {
+  public:
+    double prefix     SWIFT_PRIVATE;
+    std::string spendPublicKey     SWIFT_PRIVATE;
+    std::string viewPublicKey     SWIFT_PRIVATE;
+
+  public:
+    DecodedAddress() = default;
+    explicit DecodedAddress(double prefix, std::string spendPublicKey, std::string viewPublicKey): prefix(prefix), spendPublicKey(spendPublicKey), viewPublicKey(viewPublicKey) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ DecodedAddress <> JS DecodedAddress (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::DecodedAddress> final {
+    static inline margelo::nitro::concealcrypto::DecodedAddress fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::DecodedAddress(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "prefix")),
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, "spendPublicKey")),
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, "viewPublicKey"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::DecodedAddress& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "prefix", JSIConverter<double>::toJSI(runtime, arg.prefix));
+      obj.setProperty(runtime, "spendPublicKey", JSIConverter<std::string>::toJSI(runtime, arg.spendPublicKey));
+      obj.setProperty(runtime, "viewPublicKey", JSIConverter<std::string>::toJSI(runtime, arg.viewPublicKey));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "prefix"))) return false;
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, "spendPublicKey"))) return false;
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, "viewPublicKey"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
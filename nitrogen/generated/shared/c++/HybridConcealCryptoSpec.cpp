@@ -19,13 +19,33 @@ namespace margelo::nitro::concealcrypto {
       prototype.registerHybridMethod("bintohex", &HybridConcealCryptoSpec::bintohex);
       prototype.registerHybridMethod("bin2base64", &HybridConcealCryptoSpec::bin2base64);
       prototype.registerHybridMethod("base642bin", &HybridConcealCryptoSpec::base642bin);
+      prototype.registerHybridMethod("bin2base64Batch", &HybridConcealCryptoSpec::bin2base64Batch);
+      prototype.registerHybridMethod("base642binBatch", &HybridConcealCryptoSpec::base642binBatch);
       prototype.registerHybridMethod("chacha8", &HybridConcealCryptoSpec::chacha8);
       prototype.registerHybridMethod("chacha12", &HybridConcealCryptoSpec::chacha12);
+      prototype.registerHybridMethod("chacha20", &HybridConcealCryptoSpec::chacha20);
       prototype.registerHybridMethod("hmacSha1", &HybridConcealCryptoSpec::hmacSha1);
+      prototype.registerHybridMethod("createHmacKey", &HybridConcealCryptoSpec::createHmacKey);
+      prototype.registerHybridMethod("hotp", &HybridConcealCryptoSpec::hotp);
+      prototype.registerHybridMethod("totp", &HybridConcealCryptoSpec::totp);
+      prototype.registerHybridMethod("verifyTotp", &HybridConcealCryptoSpec::verifyTotp);
       prototype.registerHybridMethod("random", &HybridConcealCryptoSpec::random);
       prototype.registerHybridMethod("randomBytes", &HybridConcealCryptoSpec::randomBytes);
+      prototype.registerHybridMethod("mnemonicEncode", &HybridConcealCryptoSpec::mnemonicEncode);
+      prototype.registerHybridMethod("mnemonicDecode", &HybridConcealCryptoSpec::mnemonicDecode);
       prototype.registerHybridMethod("secretbox", &HybridConcealCryptoSpec::secretbox);
       prototype.registerHybridMethod("secretboxOpen", &HybridConcealCryptoSpec::secretboxOpen);
+      prototype.registerHybridMethod("secretboxOpenBatch", &HybridConcealCryptoSpec::secretboxOpenBatch);
+      prototype.registerHybridMethod("chacha8Async", &HybridConcealCryptoSpec::chacha8Async);
+      prototype.registerHybridMethod("chacha12Async", &HybridConcealCryptoSpec::chacha12Async);
+      prototype.registerHybridMethod("chacha20Async", &HybridConcealCryptoSpec::chacha20Async);
+      prototype.registerHybridMethod("secretboxAsync", &HybridConcealCryptoSpec::secretboxAsync);
+      prototype.registerHybridMethod("secretboxOpenAsync", &HybridConcealCryptoSpec::secretboxOpenAsync);
+      prototype.registerHybridMethod("secretboxOpenBatchAsync", &HybridConcealCryptoSpec::secretboxOpenBatchAsync);
+      prototype.registerHybridMethod("configureThreadPool", &HybridConcealCryptoSpec::configureThreadPool);
+      prototype.registerHybridMethod("getThreadPoolStats", &HybridConcealCryptoSpec::getThreadPoolStats);
+      prototype.registerHybridMethod("secretstreamInitPush", &HybridConcealCryptoSpec::secretstreamInitPush);
+      prototype.registerHybridMethod("secretstreamInitPull", &HybridConcealCryptoSpec::secretstreamInitPull);
     });
   }
 
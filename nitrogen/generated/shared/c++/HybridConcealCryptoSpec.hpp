@@ -17,12 +17,32 @@
 namespace margelo::nitro::concealcrypto { class HybridCryptonoteSpec; }
 // Forward declaration of `ArrayBuffer` to properly resolve imports.
 namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridHmacKeySpec` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { class HybridHmacKeySpec; }
+// Forward declaration of `SecretboxBatchResult` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct SecretboxBatchResult; }
+// Forward declaration of `HybridSecretStreamPushSpec` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { class HybridSecretStreamPushSpec; }
+// Forward declaration of `HybridSecretStreamPullSpec` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { class HybridSecretStreamPullSpec; }
+// Forward declaration of `ThreadPoolStats` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct ThreadPoolStats; }
+// Forward declaration of `Base64BatchResult` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct Base64BatchResult; }
 
 #include <memory>
 #include "HybridCryptonoteSpec.hpp"
 #include <NitroModules/ArrayBuffer.hpp>
 #include <string>
 #include <optional>
+#include "HybridHmacKeySpec.hpp"
+#include "SecretboxBatchResult.hpp"
+#include "HybridSecretStreamPushSpec.hpp"
+#include "HybridSecretStreamPullSpec.hpp"
+#include <NitroModules/Promise.hpp>
+#include "ThreadPoolStats.hpp"
+#include <vector>
+#include "Base64BatchResult.hpp"
 
 namespace margelo::nitro::concealcrypto {
 
@@ -57,15 +77,35 @@ namespace margelo::nitro::concealcrypto {
       // Methods
       virtual std::shared_ptr<ArrayBuffer> hextobin(const std::string& hex) = 0;
       virtual std::string bintohex(const std::shared_ptr<ArrayBuffer>& buffer) = 0;
-      virtual std::string bin2base64(const std::shared_ptr<ArrayBuffer>& buffer) = 0;
-      virtual std::shared_ptr<ArrayBuffer> base642bin(const std::string& base64) = 0;
+      virtual std::string bin2base64(const std::shared_ptr<ArrayBuffer>& buffer, const std::optional<std::string>& variant) = 0;
+      virtual std::shared_ptr<ArrayBuffer> base642bin(const std::string& base64, const std::optional<std::string>& variant) = 0;
+      virtual std::vector<std::string> bin2base64Batch(const std::shared_ptr<ArrayBuffer>& packed, const std::shared_ptr<ArrayBuffer>& offsets, const std::optional<std::string>& variant) = 0;
+      virtual Base64BatchResult base642binBatch(const std::vector<std::string>& base64s, const std::optional<std::string>& variant) = 0;
       virtual std::shared_ptr<ArrayBuffer> chacha8(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& iv) = 0;
       virtual std::shared_ptr<ArrayBuffer> chacha12(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& iv) = 0;
+      virtual std::shared_ptr<ArrayBuffer> chacha20(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& nonce, double counter) = 0;
       virtual std::shared_ptr<ArrayBuffer> hmacSha1(const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& data) = 0;
+      virtual std::shared_ptr<HybridHmacKeySpec> createHmacKey(const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual std::string hotp(const std::shared_ptr<ArrayBuffer>& secret, double counter, double digits, const std::string& algorithm) = 0;
+      virtual std::string totp(const std::shared_ptr<ArrayBuffer>& secret, double time, double step, double digits, const std::string& algorithm) = 0;
+      virtual bool verifyTotp(const std::shared_ptr<ArrayBuffer>& secret, const std::string& code, double time, double window, const std::optional<double>& step, const std::optional<std::string>& algorithm, const std::optional<double>& digits) = 0;
       virtual std::string random(double bits) = 0;
       virtual std::shared_ptr<ArrayBuffer> randomBytes(double bytes) = 0;
+      virtual std::string mnemonicEncode(const std::shared_ptr<ArrayBuffer>& entropy, const std::string& lang) = 0;
+      virtual std::shared_ptr<ArrayBuffer> mnemonicDecode(const std::string& words) = 0;
       virtual std::shared_ptr<ArrayBuffer> secretbox(const std::shared_ptr<ArrayBuffer>& message, const std::shared_ptr<ArrayBuffer>& nonce, const std::shared_ptr<ArrayBuffer>& key) = 0;
       virtual std::optional<std::shared_ptr<ArrayBuffer>> secretboxOpen(const std::shared_ptr<ArrayBuffer>& ciphertext, const std::shared_ptr<ArrayBuffer>& nonce, const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual SecretboxBatchResult secretboxOpenBatch(const std::shared_ptr<ArrayBuffer>& packedCiphertexts, const std::shared_ptr<ArrayBuffer>& offsets, const std::shared_ptr<ArrayBuffer>& nonces, const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha8Async(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& iv) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha12Async(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& iv) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> chacha20Async(const std::shared_ptr<ArrayBuffer>& input, const std::shared_ptr<ArrayBuffer>& key, const std::shared_ptr<ArrayBuffer>& nonce, double counter) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> secretboxAsync(const std::shared_ptr<ArrayBuffer>& message, const std::shared_ptr<ArrayBuffer>& nonce, const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual std::shared_ptr<Promise<std::optional<std::shared_ptr<ArrayBuffer>>>> secretboxOpenAsync(const std::shared_ptr<ArrayBuffer>& ciphertext, const std::shared_ptr<ArrayBuffer>& nonce, const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual std::shared_ptr<Promise<SecretboxBatchResult>> secretboxOpenBatchAsync(const std::shared_ptr<ArrayBuffer>& packedCiphertexts, const std::shared_ptr<ArrayBuffer>& offsets, const std::shared_ptr<ArrayBuffer>& nonces, const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual void configureThreadPool(double threads) = 0;
+      virtual ThreadPoolStats getThreadPoolStats() = 0;
+      virtual std::shared_ptr<HybridSecretStreamPushSpec> secretstreamInitPush(const std::shared_ptr<ArrayBuffer>& key) = 0;
+      virtual std::shared_ptr<HybridSecretStreamPullSpec> secretstreamInitPull(const std::shared_ptr<ArrayBuffer>& header, const std::shared_ptr<ArrayBuffer>& key) = 0;
 
     protected:
       // Hybrid Setup
@@ -24,6 +24,32 @@ namespace margelo::nitro::concealcrypto {
       prototype.registerHybridMethod("cnFastHash", &HybridCryptonoteSpec::cnFastHash);
       prototype.registerHybridMethod("encodeVarint", &HybridCryptonoteSpec::encodeVarint);
       prototype.registerHybridMethod("generateRingSignature", &HybridCryptonoteSpec::generateRingSignature);
+      prototype.registerHybridMethod("generateKeyDerivationBin", &HybridCryptonoteSpec::generateKeyDerivationBin);
+      prototype.registerHybridMethod("derivePublicKeyBin", &HybridCryptonoteSpec::derivePublicKeyBin);
+      prototype.registerHybridMethod("geScalarmultBin", &HybridCryptonoteSpec::geScalarmultBin);
+      prototype.registerHybridMethod("geAddBin", &HybridCryptonoteSpec::geAddBin);
+      prototype.registerHybridMethod("geScalarmultBaseBin", &HybridCryptonoteSpec::geScalarmultBaseBin);
+      prototype.registerHybridMethod("geDoubleScalarmultBaseVartimeBin", &HybridCryptonoteSpec::geDoubleScalarmultBaseVartimeBin);
+      prototype.registerHybridMethod("geDoubleScalarmultPostcompVartimeBin", &HybridCryptonoteSpec::geDoubleScalarmultPostcompVartimeBin);
+      prototype.registerHybridMethod("cnFastHashBin", &HybridCryptonoteSpec::cnFastHashBin);
+      prototype.registerHybridMethod("encodeVarintBin", &HybridCryptonoteSpec::encodeVarintBin);
+      prototype.registerHybridMethod("generateRingSignatureBin", &HybridCryptonoteSpec::generateRingSignatureBin);
+      prototype.registerHybridMethod("encodeAddress", &HybridCryptonoteSpec::encodeAddress);
+      prototype.registerHybridMethod("decodeAddress", &HybridCryptonoteSpec::decodeAddress);
+      prototype.registerHybridMethod("validateAddresses", &HybridCryptonoteSpec::validateAddresses);
+      prototype.registerHybridMethod("parseTransaction", &HybridCryptonoteSpec::parseTransaction);
+      prototype.registerHybridMethod("serializeTransactionPrefix", &HybridCryptonoteSpec::serializeTransactionPrefix);
+      prototype.registerHybridMethod("encodeVarints", &HybridCryptonoteSpec::encodeVarints);
+      prototype.registerHybridMethod("decodeVarints", &HybridCryptonoteSpec::decodeVarints);
+      prototype.registerHybridMethod("absoluteToRelativeOffsets", &HybridCryptonoteSpec::absoluteToRelativeOffsets);
+      prototype.registerHybridMethod("relativeToAbsoluteOffsets", &HybridCryptonoteSpec::relativeToAbsoluteOffsets);
+      prototype.registerHybridMethod("randomScalars", &HybridCryptonoteSpec::randomScalars);
+      prototype.registerHybridMethod("generateRingSignatureAsync", &HybridCryptonoteSpec::generateRingSignatureAsync);
+      prototype.registerHybridMethod("generateRingSignatureBinAsync", &HybridCryptonoteSpec::generateRingSignatureBinAsync);
+      prototype.registerHybridMethod("validateAddressesAsync", &HybridCryptonoteSpec::validateAddressesAsync);
+      prototype.registerHybridMethod("importSecretKey", &HybridCryptonoteSpec::importSecretKey);
+      prototype.registerHybridMethod("importSecretKeyHex", &HybridCryptonoteSpec::importSecretKeyHex);
+      prototype.registerHybridMethod("generateSecretKey", &HybridCryptonoteSpec::generateSecretKey);
     });
   }
 
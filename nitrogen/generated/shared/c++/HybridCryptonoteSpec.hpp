@@ -13,10 +13,37 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
-
+// Forward declaration of `HybridSecretKeyHandleSpec` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { class HybridSecretKeyHandleSpec; }
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `DecodedAddress` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct DecodedAddress; }
+// Forward declaration of `ParsedTransaction` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct ParsedTransaction; }
+// Forward declaration of `SerializedTransactionPrefix` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct SerializedTransactionPrefix; }
+// Forward declaration of `TransactionPrefix` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct TransactionPrefix; }
+// Forward declaration of `VarintBatchResult` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct VarintBatchResult; }
+// Forward declaration of `RingOffsetsResult` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct RingOffsetsResult; }
 
 #include <string>
+#include <memory>
+#include "HybridSecretKeyHandleSpec.hpp"
+#include <variant>
 #include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+#include "DecodedAddress.hpp"
+#include "ParsedTransaction.hpp"
+#include "SerializedTransactionPrefix.hpp"
+#include "TransactionPrefix.hpp"
+#include "VarintBatchResult.hpp"
+#include <optional>
+#include "RingOffsetsResult.hpp"
+#include <NitroModules/Promise.hpp>
 
 namespace margelo::nitro::concealcrypto {
 
@@ -49,16 +76,42 @@ namespace margelo::nitro::concealcrypto {
 
     public:
       // Methods
-      virtual std::string generateKeyDerivation(const std::string& publicKeyHex, const std::string& secretKeyHex) = 0;
+      virtual std::string generateKeyDerivation(const std::string& publicKeyHex, const std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKeyHex) = 0;
       virtual std::string derivePublicKey(const std::string& derivationHex, double outputIndex, const std::string& publicKeyHex) = 0;
-      virtual std::string geScalarmult(const std::string& publicKeyHex, const std::string& secretKeyHex) = 0;
+      virtual std::string geScalarmult(const std::string& publicKeyHex, const std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKeyHex) = 0;
       virtual std::string geAdd(const std::string& point1Hex, const std::string& point2Hex) = 0;
-      virtual std::string geScalarmultBase(const std::string& secretKeyHex) = 0;
+      virtual std::string geScalarmultBase(const std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKeyHex) = 0;
       virtual std::string geDoubleScalarmultBaseVartime(const std::string& cHex, const std::string& PHex, const std::string& rHex) = 0;
       virtual std::string geDoubleScalarmultPostcompVartime(const std::string& rHex, const std::string& PHex, const std::string& cHex, const std::string& IHex) = 0;
       virtual std::string cnFastHash(const std::string& inputHex) = 0;
       virtual std::string encodeVarint(double value) = 0;
-      virtual std::vector<std::string> generateRingSignature(const std::string& prefixHashHex, const std::string& keyImageHex, const std::vector<std::string>& publicKeysHex, const std::string& secretKeyHex, double secretIndex) = 0;
+      virtual std::vector<std::string> generateRingSignature(const std::string& prefixHashHex, const std::string& keyImageHex, const std::vector<std::string>& publicKeysHex, const std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKeyHex, double secretIndex) = 0;
+      virtual std::shared_ptr<ArrayBuffer> generateKeyDerivationBin(const std::shared_ptr<ArrayBuffer>& publicKey, const std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKey) = 0;
+      virtual std::shared_ptr<ArrayBuffer> derivePublicKeyBin(const std::shared_ptr<ArrayBuffer>& derivation, double outputIndex, const std::shared_ptr<ArrayBuffer>& publicKey) = 0;
+      virtual std::shared_ptr<ArrayBuffer> geScalarmultBin(const std::shared_ptr<ArrayBuffer>& publicKey, const std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKey) = 0;
+      virtual std::shared_ptr<ArrayBuffer> geAddBin(const std::shared_ptr<ArrayBuffer>& point1, const std::shared_ptr<ArrayBuffer>& point2) = 0;
+      virtual std::shared_ptr<ArrayBuffer> geScalarmultBaseBin(const std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKey) = 0;
+      virtual std::shared_ptr<ArrayBuffer> geDoubleScalarmultBaseVartimeBin(const std::shared_ptr<ArrayBuffer>& c, const std::shared_ptr<ArrayBuffer>& P, const std::shared_ptr<ArrayBuffer>& r) = 0;
+      virtual std::shared_ptr<ArrayBuffer> geDoubleScalarmultPostcompVartimeBin(const std::shared_ptr<ArrayBuffer>& r, const std::shared_ptr<ArrayBuffer>& P, const std::shared_ptr<ArrayBuffer>& c, const std::shared_ptr<ArrayBuffer>& I) = 0;
+      virtual std::shared_ptr<ArrayBuffer> cnFastHashBin(const std::shared_ptr<ArrayBuffer>& input) = 0;
+      virtual std::shared_ptr<ArrayBuffer> encodeVarintBin(double value) = 0;
+      virtual std::shared_ptr<ArrayBuffer> generateRingSignatureBin(const std::shared_ptr<ArrayBuffer>& prefixHash, const std::shared_ptr<ArrayBuffer>& keyImage, const std::shared_ptr<ArrayBuffer>& publicKeys, const std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKey, double secretIndex) = 0;
+      virtual std::string encodeAddress(double prefix, const std::string& spendPublicKeyHex, const std::string& viewPublicKeyHex) = 0;
+      virtual DecodedAddress decodeAddress(const std::string& address) = 0;
+      virtual std::shared_ptr<ArrayBuffer> validateAddresses(const std::vector<std::string>& addresses, double prefix) = 0;
+      virtual ParsedTransaction parseTransaction(const std::shared_ptr<ArrayBuffer>& blob) = 0;
+      virtual SerializedTransactionPrefix serializeTransactionPrefix(const TransactionPrefix& prefix) = 0;
+      virtual VarintBatchResult encodeVarints(const std::shared_ptr<ArrayBuffer>& values, const std::optional<bool>& bigint) = 0;
+      virtual VarintBatchResult decodeVarints(const std::shared_ptr<ArrayBuffer>& data) = 0;
+      virtual RingOffsetsResult absoluteToRelativeOffsets(const std::shared_ptr<ArrayBuffer>& absolute, const std::shared_ptr<ArrayBuffer>& ringSizes) = 0;
+      virtual std::shared_ptr<ArrayBuffer> relativeToAbsoluteOffsets(const std::shared_ptr<ArrayBuffer>& relative, const std::shared_ptr<ArrayBuffer>& ringSizes) = 0;
+      virtual std::shared_ptr<ArrayBuffer> randomScalars(double count) = 0;
+      virtual std::shared_ptr<Promise<std::vector<std::string>>> generateRingSignatureAsync(const std::string& prefixHashHex, const std::string& keyImageHex, const std::vector<std::string>& publicKeysHex, const std::variant<std::string, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKeyHex, double secretIndex) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> generateRingSignatureBinAsync(const std::shared_ptr<ArrayBuffer>& prefixHash, const std::shared_ptr<ArrayBuffer>& keyImage, const std::shared_ptr<ArrayBuffer>& publicKeys, const std::variant<std::shared_ptr<ArrayBuffer>, std::shared_ptr<HybridSecretKeyHandleSpec>>& secretKey, double secretIndex) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> validateAddressesAsync(const std::vector<std::string>& addresses, double prefix) = 0;
+      virtual std::shared_ptr<HybridSecretKeyHandleSpec> importSecretKey(const std::shared_ptr<ArrayBuffer>& secretKey) = 0;
+      virtual std::shared_ptr<HybridSecretKeyHandleSpec> importSecretKeyHex(const std::string& secretKeyHex) = 0;
+      virtual std::shared_ptr<HybridSecretKeyHandleSpec> generateSecretKey() = 0;
 
     protected:
       // Hybrid Setup
@@ -0,0 +1,21 @@
+///
+/// HybridHmacKeySpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridHmacKeySpec.hpp"
+
+namespace margelo::nitro::concealcrypto {
+
+  void HybridHmacKeySpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("sign", &HybridHmacKeySpec::sign);
+    });
+  }
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,63 @@
+///
+/// HybridHmacKeySpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `HmacKey`
+   * Inherit this class to create instances of `HybridHmacKeySpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridHmacKey: public HybridHmacKeySpec {
+   * public:
+   *   HybridHmacKey(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridHmacKeySpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridHmacKeySpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridHmacKeySpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<ArrayBuffer> sign(const std::shared_ptr<ArrayBuffer>& data) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "HmacKey";
+  };
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,22 @@
+///
+/// HybridSecretKeyHandleSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridSecretKeyHandleSpec.hpp"
+
+namespace margelo::nitro::concealcrypto {
+
+  void HybridSecretKeyHandleSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("getPublicKey", &HybridSecretKeyHandleSpec::getPublicKey);
+      prototype.registerHybridMethod("wipe", &HybridSecretKeyHandleSpec::wipe);
+    });
+  }
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,64 @@
+///
+/// HybridSecretKeyHandleSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `SecretKeyHandle`
+   * Inherit this class to create instances of `HybridSecretKeyHandleSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridSecretKeyHandle: public HybridSecretKeyHandleSpec {
+   * public:
+   *   HybridSecretKeyHandle(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridSecretKeyHandleSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridSecretKeyHandleSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridSecretKeyHandleSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<ArrayBuffer> getPublicKey() = 0;
+      virtual void wipe() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "SecretKeyHandle";
+  };
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,23 @@
+///
+/// HybridSecretStreamPullSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridSecretStreamPullSpec.hpp"
+
+namespace margelo::nitro::concealcrypto {
+
+  void HybridSecretStreamPullSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("tag", &HybridSecretStreamPullSpec::getTag);
+      prototype.registerHybridMethod("pull", &HybridSecretStreamPullSpec::pull);
+      prototype.registerHybridMethod("rekey", &HybridSecretStreamPullSpec::rekey);
+    });
+  }
+
+} // namespace margelo::nitro::concealcrypto
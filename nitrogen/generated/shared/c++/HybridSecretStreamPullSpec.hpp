@@ -0,0 +1,65 @@
+///
+/// HybridSecretStreamPullSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::concealcrypto {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `SecretStreamPull`
+   * Inherit this class to create instances of `HybridSecretStreamPullSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridSecretStreamPull: public HybridSecretStreamPullSpec {
+   * public:
+   *   HybridSecretStreamPull(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridSecretStreamPullSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridSecretStreamPullSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridSecretStreamPullSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getTag() = 0;
+
+    public:
+      // Methods
+      virtual std::optional<std::shared_ptr<ArrayBuffer>> pull(const std::shared_ptr<ArrayBuffer>& ciphertext) = 0;
+      virtual void rekey() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "SecretStreamPull";
+  };
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,23 @@
+///
+/// HybridSecretStreamPushSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridSecretStreamPushSpec.hpp"
+
+namespace margelo::nitro::concealcrypto {
+
+  void HybridSecretStreamPushSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("header", &HybridSecretStreamPushSpec::getHeader);
+      prototype.registerHybridMethod("push", &HybridSecretStreamPushSpec::push);
+      prototype.registerHybridMethod("rekey", &HybridSecretStreamPushSpec::rekey);
+    });
+  }
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,64 @@
+///
+/// HybridSecretStreamPushSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `SecretStreamPush`
+   * Inherit this class to create instances of `HybridSecretStreamPushSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridSecretStreamPush: public HybridSecretStreamPushSpec {
+   * public:
+   *   HybridSecretStreamPush(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridSecretStreamPushSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridSecretStreamPushSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridSecretStreamPushSpec() override = default;
+
+    public:
+      // Properties
+      virtual std::shared_ptr<ArrayBuffer> getHeader() = 0;
+
+    public:
+      // Methods
+      virtual std::shared_ptr<ArrayBuffer> push(const std::shared_ptr<ArrayBuffer>& message, double tag) = 0;
+      virtual void rekey() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "SecretStreamPush";
+  };
+
+} // namespace margelo::nitro::concealcrypto
@@ -0,0 +1,114 @@
+///
+/// ParsedTransaction.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `TransactionInputInfo` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct TransactionInputInfo; }
+// Forward declaration of `TransactionOutputInfo` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct TransactionOutputInfo; }
+
+#include "TransactionInputInfo.hpp"
+#include <vector>
+#include "TransactionOutputInfo.hpp"
+#include <string>
+#include <optional>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ParsedTransaction).
+   */
+  struct ParsedTransaction {
+  public:
+    double version     SWIFT_PRIVATE;
+    double unlockTime     SWIFT_PRIVATE;
+    double prefixLength     SWIFT_PRIVATE;
+    std::vector<TransactionInputInfo> inputs     SWIFT_PRIVATE;
+    std::vector<TransactionOutputInfo> outputs     SWIFT_PRIVATE;
+    double extraOffset     SWIFT_PRIVATE;
+    double extraLength     SWIFT_PRIVATE;
+    double publicKeyOffset     SWIFT_PRIVATE;
+    std::optional<std::string> publicKey     SWIFT_PRIVATE;
+    double signaturesOffset     SWIFT_PRIVATE;
+    double signaturesLength     SWIFT_PRIVATE;
+
+  public:
+    ParsedTransaction() = default;
+    explicit ParsedTransaction(double version, double unlockTime, double prefixLength, std::vector<TransactionInputInfo> inputs, std::vector<TransactionOutputInfo> outputs, double extraOffset, double extraLength, double publicKeyOffset, std::optional<std::string> publicKey, double signaturesOffset, double signaturesLength): version(version), unlockTime(unlockTime), prefixLength(prefixLength), inputs(inputs), outputs(outputs), extraOffset(extraOffset), extraLength(extraLength), publicKeyOffset(publicKeyOffset), publicKey(publicKey), signaturesOffset(signaturesOffset), signaturesLength(signaturesLength) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ ParsedTransaction <> JS ParsedTransaction (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::ParsedTransaction> final {
+    static inline margelo::nitro::concealcrypto::ParsedTransaction fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::ParsedTransaction(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "version")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "unlockTime")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "prefixLength")),
+        JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInputInfo>>::fromJSI(runtime, obj.getProperty(runtime, "inputs")),
+        JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutputInfo>>::fromJSI(runtime, obj.getProperty(runtime, "outputs")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "extraOffset")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "extraLength")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "publicKeyOffset")),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, "publicKey")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "signaturesOffset")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "signaturesLength"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::ParsedTransaction& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "version", JSIConverter<double>::toJSI(runtime, arg.version));
+      obj.setProperty(runtime, "unlockTime", JSIConverter<double>::toJSI(runtime, arg.unlockTime));
+      obj.setProperty(runtime, "prefixLength", JSIConverter<double>::toJSI(runtime, arg.prefixLength));
+      obj.setProperty(runtime, "inputs", JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInputInfo>>::toJSI(runtime, arg.inputs));
+      obj.setProperty(runtime, "outputs", JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutputInfo>>::toJSI(runtime, arg.outputs));
+      obj.setProperty(runtime, "extraOffset", JSIConverter<double>::toJSI(runtime, arg.extraOffset));
+      obj.setProperty(runtime, "extraLength", JSIConverter<double>::toJSI(runtime, arg.extraLength));
+      obj.setProperty(runtime, "publicKeyOffset", JSIConverter<double>::toJSI(runtime, arg.publicKeyOffset));
+      obj.setProperty(runtime, "publicKey", JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.publicKey));
+      obj.setProperty(runtime, "signaturesOffset", JSIConverter<double>::toJSI(runtime, arg.signaturesOffset));
+      obj.setProperty(runtime, "signaturesLength", JSIConverter<double>::toJSI(runtime, arg.signaturesLength));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "version"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "unlockTime"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "prefixLength"))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInputInfo>>::canConvert(runtime, obj.getProperty(runtime, "inputs"))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutputInfo>>::canConvert(runtime, obj.getProperty(runtime, "outputs"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "extraOffset"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "extraLength"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "publicKeyOffset"))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, "publicKey"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "signaturesOffset"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "signaturesLength"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
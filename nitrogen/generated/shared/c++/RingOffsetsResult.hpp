@@ -0,0 +1,76 @@
+///
+/// RingOffsetsResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RingOffsetsResult).
+   */
+  struct RingOffsetsResult {
+  public:
+    std::shared_ptr<ArrayBuffer> relative     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> packed     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> packedOffsets     SWIFT_PRIVATE;
+
+  public:
+    RingOffsetsResult() = default;
+    explicit RingOffsetsResult(std::shared_ptr<ArrayBuffer> relative, std::shared_ptr<ArrayBuffer> packed, std::shared_ptr<ArrayBuffer> packedOffsets): relative(relative), packed(packed), packedOffsets(packedOffsets) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ RingOffsetsResult <> JS RingOffsetsResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::RingOffsetsResult> final {
+    static inline margelo::nitro::concealcrypto::RingOffsetsResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::RingOffsetsResult(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "relative")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "packed")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "packedOffsets"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::RingOffsetsResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "relative", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.relative));
+      obj.setProperty(runtime, "packed", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.packed));
+      obj.setProperty(runtime, "packedOffsets", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.packedOffsets));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "relative"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "packed"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "packedOffsets"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,76 @@
+///
+/// SecretboxBatchResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (SecretboxBatchResult).
+   */
+  struct SecretboxBatchResult {
+  public:
+    std::shared_ptr<ArrayBuffer> messages     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> offsets     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> status     SWIFT_PRIVATE;
+
+  public:
+    SecretboxBatchResult() = default;
+    explicit SecretboxBatchResult(std::shared_ptr<ArrayBuffer> messages, std::shared_ptr<ArrayBuffer> offsets, std::shared_ptr<ArrayBuffer> status): messages(messages), offsets(offsets), status(status) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ SecretboxBatchResult <> JS SecretboxBatchResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::SecretboxBatchResult> final {
+    static inline margelo::nitro::concealcrypto::SecretboxBatchResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::SecretboxBatchResult(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "messages")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "offsets")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "status"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::SecretboxBatchResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "messages", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.messages));
+      obj.setProperty(runtime, "offsets", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.offsets));
+      obj.setProperty(runtime, "status", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.status));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "messages"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "offsets"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "status"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
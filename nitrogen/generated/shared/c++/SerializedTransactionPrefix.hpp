@@ -0,0 +1,72 @@
+///
+/// SerializedTransactionPrefix.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (SerializedTransactionPrefix).
+   */
+  struct SerializedTransactionPrefix {
+  public:
+    std::shared_ptr<ArrayBuffer> blob     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> hash     SWIFT_PRIVATE;
+
+  public:
+    SerializedTransactionPrefix() = default;
+    explicit SerializedTransactionPrefix(std::shared_ptr<ArrayBuffer> blob, std::shared_ptr<ArrayBuffer> hash): blob(blob), hash(hash) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ SerializedTransactionPrefix <> JS SerializedTransactionPrefix (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::SerializedTransactionPrefix> final {
+    static inline margelo::nitro::concealcrypto::SerializedTransactionPrefix fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::SerializedTransactionPrefix(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "blob")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "hash"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::SerializedTransactionPrefix& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "blob", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.blob));
+      obj.setProperty(runtime, "hash", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.hash));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "blob"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "hash"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
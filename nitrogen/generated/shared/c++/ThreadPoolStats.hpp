@@ -0,0 +1,86 @@
+///
+/// ThreadPoolStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ThreadPoolStats).
+   */
+  struct ThreadPoolStats {
+  public:
+    double threads     SWIFT_PRIVATE;
+    double queueDepthHigh     SWIFT_PRIVATE;
+    double queueDepthNormal     SWIFT_PRIVATE;
+    double queueDepthLow     SWIFT_PRIVATE;
+    double steals     SWIFT_PRIVATE;
+    double executed     SWIFT_PRIVATE;
+
+  public:
+    ThreadPoolStats() = default;
+    explicit ThreadPoolStats(double threads, double queueDepthHigh, double queueDepthNormal, double queueDepthLow, double steals, double executed): threads(threads), queueDepthHigh(queueDepthHigh), queueDepthNormal(queueDepthNormal), queueDepthLow(queueDepthLow), steals(steals), executed(executed) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ ThreadPoolStats <> JS ThreadPoolStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::ThreadPoolStats> final {
+    static inline margelo::nitro::concealcrypto::ThreadPoolStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::ThreadPoolStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "threads")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "queueDepthHigh")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "queueDepthNormal")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "queueDepthLow")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "steals")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "executed"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::ThreadPoolStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "threads", JSIConverter<double>::toJSI(runtime, arg.threads));
+      obj.setProperty(runtime, "queueDepthHigh", JSIConverter<double>::toJSI(runtime, arg.queueDepthHigh));
+      obj.setProperty(runtime, "queueDepthNormal", JSIConverter<double>::toJSI(runtime, arg.queueDepthNormal));
+      obj.setProperty(runtime, "queueDepthLow", JSIConverter<double>::toJSI(runtime, arg.queueDepthLow));
+      obj.setProperty(runtime, "steals", JSIConverter<double>::toJSI(runtime, arg.steals));
+      obj.setProperty(runtime, "executed", JSIConverter<double>::toJSI(runtime, arg.executed));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "threads"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "queueDepthHigh"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "queueDepthNormal"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "queueDepthLow"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "steals"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "executed"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,98 @@
+///
+/// TransactionInput.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <optional>
+#include <vector>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (TransactionInput).
+   */
+  struct TransactionInput {
+  public:
+    double type     SWIFT_PRIVATE;
+    double amount     SWIFT_PRIVATE;
+    std::optional<double> blockIndex     SWIFT_PRIVATE;
+    std::optional<std::vector<double>> outputIndexes     SWIFT_PRIVATE;
+    std::optional<std::shared_ptr<ArrayBuffer>> keyImage     SWIFT_PRIVATE;
+    std::optional<double> signatureCount     SWIFT_PRIVATE;
+    std::optional<double> outputIndex     SWIFT_PRIVATE;
+    std::optional<double> term     SWIFT_PRIVATE;
+
+  public:
+    TransactionInput() = default;
+    explicit TransactionInput(double type, double amount, std::optional<double> blockIndex, std::optional<std::vector<double>> outputIndexes, std::optional<std::shared_ptr<ArrayBuffer>> keyImage, std::optional<double> signatureCount, std::optional<double> outputIndex, std::optional<double> term): type(type), amount(amount), blockIndex(blockIndex), outputIndexes(outputIndexes), keyImage(keyImage), signatureCount(signatureCount), outputIndex(outputIndex), term(term) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ TransactionInput <> JS TransactionInput (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::TransactionInput> final {
+    static inline margelo::nitro::concealcrypto::TransactionInput fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::TransactionInput(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "type")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "amount")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "blockIndex")),
+        JSIConverter<std::optional<std::vector<double>>>::fromJSI(runtime, obj.getProperty(runtime, "outputIndexes")),
+        JSIConverter<std::optional<std::shared_ptr<ArrayBuffer>>>::fromJSI(runtime, obj.getProperty(runtime, "keyImage")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "signatureCount")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "outputIndex")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "term"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::TransactionInput& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "type", JSIConverter<double>::toJSI(runtime, arg.type));
+      obj.setProperty(runtime, "amount", JSIConverter<double>::toJSI(runtime, arg.amount));
+      obj.setProperty(runtime, "blockIndex", JSIConverter<std::optional<double>>::toJSI(runtime, arg.blockIndex));
+      obj.setProperty(runtime, "outputIndexes", JSIConverter<std::optional<std::vector<double>>>::toJSI(runtime, arg.outputIndexes));
+      obj.setProperty(runtime, "keyImage", JSIConverter<std::optional<std::shared_ptr<ArrayBuffer>>>::toJSI(runtime, arg.keyImage));
+      obj.setProperty(runtime, "signatureCount", JSIConverter<std::optional<double>>::toJSI(runtime, arg.signatureCount));
+      obj.setProperty(runtime, "outputIndex", JSIConverter<std::optional<double>>::toJSI(runtime, arg.outputIndex));
+      obj.setProperty(runtime, "term", JSIConverter<std::optional<double>>::toJSI(runtime, arg.term));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "type"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "amount"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "blockIndex"))) return false;
+      if (!JSIConverter<std::optional<std::vector<double>>>::canConvert(runtime, obj.getProperty(runtime, "outputIndexes"))) return false;
+      if (!JSIConverter<std::optional<std::shared_ptr<ArrayBuffer>>>::canConvert(runtime, obj.getProperty(runtime, "keyImage"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "signatureCount"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "outputIndex"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "term"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,85 @@
+///
+/// TransactionOutput.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <optional>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (TransactionOutput).
+   */
+  struct TransactionOutput {
+  public:
+    double amount     SWIFT_PRIVATE;
+    double type     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> keys     SWIFT_PRIVATE;
+    std::optional<double> requiredSignatureCount     SWIFT_PRIVATE;
+    std::optional<double> term     SWIFT_PRIVATE;
+
+  public:
+    TransactionOutput() = default;
+    explicit TransactionOutput(double amount, double type, std::shared_ptr<ArrayBuffer> keys, std::optional<double> requiredSignatureCount, std::optional<double> term): amount(amount), type(type), keys(keys), requiredSignatureCount(requiredSignatureCount), term(term) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ TransactionOutput <> JS TransactionOutput (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::TransactionOutput> final {
+    static inline margelo::nitro::concealcrypto::TransactionOutput fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::TransactionOutput(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "amount")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "type")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "keys")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "requiredSignatureCount")),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, "term"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::TransactionOutput& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "amount", JSIConverter<double>::toJSI(runtime, arg.amount));
+      obj.setProperty(runtime, "type", JSIConverter<double>::toJSI(runtime, arg.type));
+      obj.setProperty(runtime, "keys", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.keys));
+      obj.setProperty(runtime, "requiredSignatureCount", JSIConverter<std::optional<double>>::toJSI(runtime, arg.requiredSignatureCount));
+      obj.setProperty(runtime, "term", JSIConverter<std::optional<double>>::toJSI(runtime, arg.term));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "amount"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "type"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "keys"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "requiredSignatureCount"))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, "term"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
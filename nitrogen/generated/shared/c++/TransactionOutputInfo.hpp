@@ -0,0 +1,86 @@
+///
+/// TransactionOutputInfo.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (TransactionOutputInfo).
+   */
+  struct TransactionOutputInfo {
+  public:
+    double type     SWIFT_PRIVATE;
+    double amount     SWIFT_PRIVATE;
+    double offset     SWIFT_PRIVATE;
+    double length     SWIFT_PRIVATE;
+    double keyOffset     SWIFT_PRIVATE;
+    double keyCount     SWIFT_PRIVATE;
+
+  public:
+    TransactionOutputInfo() = default;
+    explicit TransactionOutputInfo(double type, double amount, double offset, double length, double keyOffset, double keyCount): type(type), amount(amount), offset(offset), length(length), keyOffset(keyOffset), keyCount(keyCount) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ TransactionOutputInfo <> JS TransactionOutputInfo (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::TransactionOutputInfo> final {
+    static inline margelo::nitro::concealcrypto::TransactionOutputInfo fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::TransactionOutputInfo(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "type")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "amount")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "offset")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "length")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "keyOffset")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "keyCount"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::TransactionOutputInfo& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "type", JSIConverter<double>::toJSI(runtime, arg.type));
+      obj.setProperty(runtime, "amount", JSIConverter<double>::toJSI(runtime, arg.amount));
+      obj.setProperty(runtime, "offset", JSIConverter<double>::toJSI(runtime, arg.offset));
+      obj.setProperty(runtime, "length", JSIConverter<double>::toJSI(runtime, arg.length));
+      obj.setProperty(runtime, "keyOffset", JSIConverter<double>::toJSI(runtime, arg.keyOffset));
+      obj.setProperty(runtime, "keyCount", JSIConverter<double>::toJSI(runtime, arg.keyCount));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "type"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "amount"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "offset"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "length"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "keyOffset"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "keyCount"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,91 @@
+///
+/// TransactionPrefix.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `TransactionInput` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct TransactionInput; }
+// Forward declaration of `TransactionOutput` to properly resolve imports.
+namespace margelo::nitro::concealcrypto { struct TransactionOutput; }
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include "TransactionInput.hpp"
+#include <vector>
+#include "TransactionOutput.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::concealcrypto {
+
+  /**
+   * A struct which can be represented as a JavaScript object (TransactionPrefix).
+   */
+  struct TransactionPrefix {
+  public:
+    double version     SWIFT_PRIVATE;
+    double unlockTime     SWIFT_PRIVATE;
+    std::vector<TransactionInput> inputs     SWIFT_PRIVATE;
+    std::vector<TransactionOutput> outputs     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> extra     SWIFT_PRIVATE;
+
+  public:
+    TransactionPrefix() = default;
+    explicit TransactionPrefix(double version, double unlockTime, std::vector<TransactionInput> inputs, std::vector<TransactionOutput> outputs, std::shared_ptr<ArrayBuffer> extra): version(version), unlockTime(unlockTime), inputs(inputs), outputs(outputs), extra(extra) {}
+  };
+
+} // namespace margelo::nitro::concealcrypto
+
+namespace margelo::nitro {
+
+  // C++ TransactionPrefix <> JS TransactionPrefix (object)
+  template <>
+  struct JSIConverter<margelo::nitro::concealcrypto::TransactionPrefix> final {
+    static inline margelo::nitro::concealcrypto::TransactionPrefix fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::concealcrypto::TransactionPrefix(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "version")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "unlockTime")),
+        JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInput>>::fromJSI(runtime, obj.getProperty(runtime, "inputs")),
+        JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutput>>::fromJSI(runtime, obj.getProperty(runtime, "outputs")),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "extra"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::concealcrypto::TransactionPrefix& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "version", JSIConverter<double>::toJSI(runtime, arg.version));
+      obj.setProperty(runtime, "unlockTime", JSIConverter<double>::toJSI(runtime, arg.unlockTime));
+      obj.setProperty(runtime, "inputs", JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInput>>::toJSI(runtime, arg.inputs));
+      obj.setProperty(runtime, "outputs", JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutput>>::toJSI(runtime, arg.outputs));
+      obj.setProperty(runtime, "extra", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.extra));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "version"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "unlockTime"))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionInput>>::canConvert(runtime, obj.getProperty(runtime, "inputs"))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::concealcrypto::TransactionOutput>>::canConvert(runtime, obj.getProperty(runtime, "outputs"))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "extra"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
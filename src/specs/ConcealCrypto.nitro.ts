@@ -1,19 +1,133 @@
 import type { HybridObject } from 'react-native-nitro-modules';
 import type { Cryptonote } from './Cryptonote.nitro';
+import type { HmacKey } from './HmacKey.nitro';
+import type { SecretStreamPull, SecretStreamPush } from './SecretStream.nitro';
+
+/**
+ * Result of `secretboxOpenBatch`
+ * - messages: all plaintexts packed back to back
+ * - offsets: Uint32Array(n + 1) of start offsets into `messages` (last entry = total length)
+ * - status: Uint8Array(n), 1 = opened, 0 = authentication failed (slot zero-filled)
+ */
+export interface SecretboxBatchResult {
+  messages: ArrayBuffer;
+  offsets: ArrayBuffer;
+  status: ArrayBuffer;
+}
+
+/**
+ * Result of `base642binBatch`
+ * - data: all decoded strings packed back to back
+ * - offsets: Uint32Array(n + 1) of start offsets into `data` (last entry = total length)
+ * - status: Uint8Array(n), 1 = decoded, 0 = malformed (slot zero-filled)
+ */
+export interface Base64BatchResult {
+  data: ArrayBuffer;
+  offsets: ArrayBuffer;
+  status: ArrayBuffer;
+}
+
+/**
+ * Result of `getThreadPoolStats`
+ * - threads: native worker count
+ * - queueDepthHigh / queueDepthNormal / queueDepthLow: queued tasks per priority
+ * - steals: tasks a worker took from another worker's queue
+ * - executed: tasks run by the workers since startup
+ */
+export interface ThreadPoolStats {
+  threads: number;
+  queueDepthHigh: number;
+  queueDepthNormal: number;
+  queueDepthLow: number;
+  steals: number;
+  executed: number;
+}
 
 export interface ConcealCrypto extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
   // Basic crypto functions
   hextobin(hex: string): ArrayBuffer;
   bintohex(buffer: ArrayBuffer): string;
-  bin2base64(buffer: ArrayBuffer): string;
-  base642bin(base64: string): ArrayBuffer;
+  /**
+   * Base64 encode / decode. `variant` is `"original"` (default, "+/" with padding,
+   * as nacl.util), `"original-no-padding"`, `"urlsafe"` ("-_" with padding) or
+   * `"urlsafe-no-padding"`. Decoding is strict: padding must match the variant.
+   */
+  bin2base64(buffer: ArrayBuffer, variant?: string): string;
+  base642bin(base64: string, variant?: string): ArrayBuffer;
+  /**
+   * Encode n buffers packed back to back, delimited by `offsets`
+   * (Uint32Array of n + 1 entries, last entry = packed length).
+   */
+  bin2base64Batch(packed: ArrayBuffer, offsets: ArrayBuffer, variant?: string): string[];
+  /**
+   * Decode n strings into one packed buffer; see `Base64BatchResult`.
+   */
+  base642binBatch(base64s: string[], variant?: string): Base64BatchResult;
   chacha8(input: ArrayBuffer, key: ArrayBuffer, iv: ArrayBuffer): ArrayBuffer;
   chacha12(input: ArrayBuffer, key: ArrayBuffer, iv: ArrayBuffer): ArrayBuffer;
+  chacha20(input: ArrayBuffer, key: ArrayBuffer, nonce: ArrayBuffer, counter: number): ArrayBuffer;
   hmacSha1(key: ArrayBuffer, data: ArrayBuffer): ArrayBuffer;
+  createHmacKey(key: ArrayBuffer): HmacKey;
+  hotp(secret: ArrayBuffer, counter: number, digits: number, algorithm: string): string;
+  totp(secret: ArrayBuffer, time: number, step: number, digits: number, algorithm: string): string;
+  verifyTotp(
+    secret: ArrayBuffer,
+    code: string,
+    time: number,
+    window: number,
+    step?: number,
+    algorithm?: string,
+    digits?: number
+  ): boolean;
   random(bits: number): string;
   randomBytes(bytes: number): ArrayBuffer;
+  /**
+   * Encode entropy (non-empty multiple of 4 bytes, e.g. from `randomBytes(32)`) as an
+   * Electrum-style mnemonic: 3 words per 4 bytes plus a CRC32 checksum word.
+   * `lang` selects the wordlist (currently `"english"`).
+   */
+  mnemonicEncode(entropy: ArrayBuffer, lang: string): string;
+  /**
+   * Decode a mnemonic (3n words, or 3n + 1 with the checksum word) back to entropy.
+   * Words are matched by their 3-letter prefix; throws on unknown words or checksum mismatch.
+   */
+  mnemonicDecode(words: string): ArrayBuffer;
   secretbox(message: ArrayBuffer, nonce: ArrayBuffer, key: ArrayBuffer): ArrayBuffer;
   secretboxOpen(ciphertext: ArrayBuffer, nonce: ArrayBuffer, key: ArrayBuffer): ArrayBuffer | null;
+  secretboxOpenBatch(
+    packedCiphertexts: ArrayBuffer,
+    offsets: ArrayBuffer,
+    nonces: ArrayBuffer,
+    key: ArrayBuffer
+  ): SecretboxBatchResult;
+
+  // Promise variants: same behaviour as the synchronous methods, run on the native
+  // thread pool so large buffers do not block the JS thread. Arguments are copied
+  // before the call returns, so callers may reuse their buffers immediately.
+  chacha8Async(input: ArrayBuffer, key: ArrayBuffer, iv: ArrayBuffer): Promise<ArrayBuffer>;
+  chacha12Async(input: ArrayBuffer, key: ArrayBuffer, iv: ArrayBuffer): Promise<ArrayBuffer>;
+  chacha20Async(input: ArrayBuffer, key: ArrayBuffer, nonce: ArrayBuffer, counter: number): Promise<ArrayBuffer>;
+  secretboxAsync(message: ArrayBuffer, nonce: ArrayBuffer, key: ArrayBuffer): Promise<ArrayBuffer>;
+  secretboxOpenAsync(ciphertext: ArrayBuffer, nonce: ArrayBuffer, key: ArrayBuffer): Promise<ArrayBuffer | null>;
+  secretboxOpenBatchAsync(
+    packedCiphertexts: ArrayBuffer,
+    offsets: ArrayBuffer,
+    nonces: ArrayBuffer,
+    key: ArrayBuffer
+  ): Promise<SecretboxBatchResult>;
+
+  // Native thread pool shared by the batch and *Async methods. Ring signing runs at
+  // high priority, batch opening / validation at low priority, everything else normal.
+  /**
+   * Resize the pool (1 to 64 workers).
+   * Defaults to one worker per core minus one for the JS thread, and at least one.
+   */
+  configureThreadPool(threads: number): void;
+  getThreadPoolStats(): ThreadPoolStats;
+
+  // Streaming authenticated encryption (libsodium secretstream XChaCha20-Poly1305)
+  secretstreamInitPush(key: ArrayBuffer): SecretStreamPush;
+  secretstreamInitPull(header: ArrayBuffer, key: ArrayBuffer): SecretStreamPull;
 
   // Cryptonote elliptic curve operations
   readonly cryptonote: Cryptonote;
@@ -1,4 +1,156 @@
 import type { HybridObject } from 'react-native-nitro-modules';
+import type { SecretKeyHandle } from './SecretKeyHandle.nitro';
+
+/**
+ * Fields of a decoded Cryptonote address
+ */
+export interface DecodedAddress {
+  /** Network prefix (e.g. 0x7ad4 for Conceal mainnet "ccx7" addresses) */
+  prefix: number;
+  /** 64-char hex public spend key */
+  spendPublicKey: string;
+  /** 64-char hex public view key */
+  viewPublicKey: string;
+}
+
+/**
+ * One transaction input. Offsets are byte offsets into the parsed blob.
+ */
+export interface TransactionInputInfo {
+  /** Variant tag: 0xff = coinbase, 0x02 = key, 0x03 = multisignature */
+  type: number;
+  /** Amount (0 for coinbase) */
+  amount: number;
+  /** Offset of the variant tag */
+  offset: number;
+  /** Serialized size including the tag */
+  length: number;
+  /** Number of signatures this input carries (ring size / multisig signature count) */
+  ringSize: number;
+  /** Offset of the 32-byte key image, -1 if not a key input */
+  keyImageOffset: number;
+}
+
+/**
+ * One transaction output. Offsets are byte offsets into the parsed blob.
+ */
+export interface TransactionOutputInfo {
+  /** Target variant tag: 0x02 = key, 0x03 = multisignature */
+  type: number;
+  amount: number;
+  /** Offset of the amount varint */
+  offset: number;
+  /** Serialized size */
+  length: number;
+  /** Offset of the first 32-byte output key */
+  keyOffset: number;
+  /** Number of consecutive 32-byte keys at keyOffset */
+  keyCount: number;
+}
+
+/**
+ * Transaction layout returned by parseTransaction
+ */
+export interface ParsedTransaction {
+  version: number;
+  unlockTime: number;
+  /** Prefix size: blob[0, prefixLength) is what the prefix hash covers */
+  prefixLength: number;
+  inputs: TransactionInputInfo[];
+  outputs: TransactionOutputInfo[];
+  extraOffset: number;
+  extraLength: number;
+  /** Offset of the transaction public key in extra, -1 if none */
+  publicKeyOffset: number;
+  /** 64-char hex transaction public key, if present in extra */
+  publicKey?: string;
+  signaturesOffset: number;
+  /** 0 when the blob is a bare prefix */
+  signaturesLength: number;
+}
+
+/**
+ * Transaction input for serializeTransactionPrefix.
+ * Fields beyond type/amount are required per type.
+ */
+export interface TransactionInput {
+  /** 0xff = coinbase, 0x02 = key, 0x03 = multisignature */
+  type: number;
+  /** Amount (ignored for coinbase) */
+  amount: number;
+  /** Coinbase: block height */
+  blockIndex?: number;
+  /** Key input: relative output offsets as written on the wire */
+  outputIndexes?: number[];
+  /** Key input: 32-byte key image */
+  keyImage?: ArrayBuffer;
+  /** Multisignature input fields */
+  signatureCount?: number;
+  outputIndex?: number;
+  term?: number;
+}
+
+/**
+ * Transaction output for serializeTransactionPrefix
+ */
+export interface TransactionOutput {
+  amount: number;
+  /** 0x02 = key, 0x03 = multisignature */
+  type: number;
+  /** 32 bytes for a key output, n*32 bytes for a multisignature output */
+  keys: ArrayBuffer;
+  /** Multisignature output fields */
+  requiredSignatureCount?: number;
+  term?: number;
+}
+
+/**
+ * Structured transaction prefix
+ */
+export interface TransactionPrefix {
+  version: number;
+  unlockTime: number;
+  inputs: TransactionInput[];
+  outputs: TransactionOutput[];
+  /** Raw extra field bytes */
+  extra: ArrayBuffer;
+}
+
+/**
+ * Result of encodeVarints / decodeVarints
+ * - data: encode = packed varints (rejected elements write nothing);
+ *         decode = BigUint64Array values (0 for rejected elements)
+ * - status: Uint8Array(n) per element: 0 = ok, 1 = overflow (beyond 64 bits, or
+ *   beyond Number.MAX_SAFE_INTEGER for Float64 input), 2 = non-canonical encoding,
+ *   3 = truncated, 4 = not a non-negative integer
+ */
+export interface VarintBatchResult {
+  data: ArrayBuffer;
+  status: ArrayBuffer;
+}
+
+/**
+ * Result of absoluteToRelativeOffsets
+ * - relative: Float64Array of relative offsets, same layout as the input
+ * - packed: per ring, varint(ringSize) followed by the relative offsets as varints
+ *   (the key input wire format), rings back to back
+ * - packedOffsets: Uint32Array(rings + 1) of start offsets into `packed`
+ */
+export interface RingOffsetsResult {
+  relative: ArrayBuffer;
+  packed: ArrayBuffer;
+  packedOffsets: ArrayBuffer;
+}
+
+/**
+ * Result of serializeTransactionPrefix
+ */
+export interface SerializedTransactionPrefix {
+  /** Serialized prefix */
+  blob: ArrayBuffer;
+  /** 32-byte cnFastHash of blob (the prefix hash that ring signatures sign) */
+  hash: ArrayBuffer;
+}
 
 /**
  * Cryptonote elliptic curve operations for blockchain operations
@@ -10,10 +162,10 @@ export interface Cryptonote extends HybridObject<{ ios: 'c++'; android: 'c++' }>
   /**
    * Generate a key derivation from a public key and secret key
    * @param publicKeyHex - 64-char hex string (32 bytes)
-   * @param secretKeyHex - 64-char hex string (32 bytes)
+   * @param secretKeyHex - 64-char hex string (32 bytes) or SecretKeyHandle
    * @returns 64-char hex string - key derivation
    */
-  generateKeyDerivation(publicKeyHex: string, secretKeyHex: string): string;
+  generateKeyDerivation(publicKeyHex: string, secretKeyHex: string | SecretKeyHandle): string;
 
   /**
    * Derive a public key from a key derivation
@@ -27,10 +179,10 @@ export interface Cryptonote extends HybridObject<{ ios: 'c++'; android: 'c++' }>
   /**
    * Scalar multiplication of an elliptic curve point
    * @param publicKeyHex - 64-char hex string (32 bytes)
-   * @param secretKeyHex - 64-char hex string (32 bytes)
+   * @param secretKeyHex - 64-char hex string (32 bytes) or SecretKeyHandle
    * @returns 64-char hex string - result point
    */
-  geScalarmult(publicKeyHex: string, secretKeyHex: string): string;
+  geScalarmult(publicKeyHex: string, secretKeyHex: string | SecretKeyHandle): string;
 
   /**
    * Add two elliptic curve points
@@ -42,10 +194,10 @@ export interface Cryptonote extends HybridObject<{ ios: 'c++'; android: 'c++' }>
 
   /**
    * Scalar multiplication of the base point
-   * @param secretKeyHex - 64-char hex string (32 bytes)
+   * @param secretKeyHex - 64-char hex string (32 bytes) or SecretKeyHandle
    * @returns 64-char hex string - result point
    */
-  geScalarmultBase(secretKeyHex: string): string;
+  geScalarmultBase(secretKeyHex: string | SecretKeyHandle): string;
 
   /**
    * Double scalar multiplication with base point: c*P + r*G
@@ -112,8 +264,8 @@ export interface Cryptonote extends HybridObject<{ ios: 'c++'; android: 'c++' }>
    *
    * @param prefixHashHex - 64-char hex string (32 bytes) - transaction prefix hash
    * @param keyImageHex - 64-char hex string (32 bytes) - key image of the real input
-   * @param publicKeysHex - Array of 64-char hex strings - ring member public keys (mixin + real)
-   * @param secretKeyHex - 64-char hex string (32 bytes) - secret key of real input
+   * @param publicKeysHex - Array of 64-char hex strings - ring member public keys (mixin + real, at most 1024)
+   * @param secretKeyHex - 64-char hex string (32 bytes) or SecretKeyHandle - secret key of real input
    * @param secretIndex - Index of the real input in the ring (0 to publicKeysHex.length - 1)
    *
    * @returns Array of 128-char hex strings (64-byte signatures) - one per ring member
@@ -134,7 +286,247 @@ export interface Cryptonote extends HybridObject<{ ios: 'c++'; android: 'c++' }>
     prefixHashHex: string,
     keyImageHex: string,
     publicKeysHex: string[],
-    secretKeyHex: string,
+    secretKeyHex: string | SecretKeyHandle,
     secretIndex: number
   ): string[];
+
+  // ---------------------------------------------------------------------------
+  // Binary variants
+  // Same operations as above on raw 32-byte ArrayBuffers, skipping the hex
+  // encode/decode and JS string creation. Prefer these in hot loops (e.g. output
+  // scanning) where keys are already held as bytes.
+  // ---------------------------------------------------------------------------
+
+  /**
+   * Binary variant of generateKeyDerivation
+   * @param publicKey - 32-byte public key
+   * @param secretKey - 32-byte secret key or SecretKeyHandle
+   * @returns 32-byte key derivation
+   */
+  generateKeyDerivationBin(publicKey: ArrayBuffer, secretKey: ArrayBuffer | SecretKeyHandle): ArrayBuffer;
+
+  /**
+   * Binary variant of derivePublicKey
+   * @param derivation - 32-byte key derivation
+   * @param outputIndex - Output index number
+   * @param publicKey - 32-byte base public key
+   * @returns 32-byte derived public key
+   */
+  derivePublicKeyBin(derivation: ArrayBuffer, outputIndex: number, publicKey: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Binary variant of geScalarmult
+   * @returns 32-byte result point
+   */
+  geScalarmultBin(publicKey: ArrayBuffer, secretKey: ArrayBuffer | SecretKeyHandle): ArrayBuffer;
+
+  /**
+   * Binary variant of geAdd
+   * @returns 32-byte sum point
+   */
+  geAddBin(point1: ArrayBuffer, point2: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Binary variant of geScalarmultBase
+   * @returns 32-byte result point
+   */
+  geScalarmultBaseBin(secretKey: ArrayBuffer | SecretKeyHandle): ArrayBuffer;
+
+  /**
+   * Binary variant of geDoubleScalarmultBaseVartime: c*P + r*G
+   * @returns 32-byte result point
+   */
+  geDoubleScalarmultBaseVartimeBin(c: ArrayBuffer, P: ArrayBuffer, r: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Binary variant of geDoubleScalarmultPostcompVartime: r*Pb + c*I
+   * @returns 32-byte result point
+   */
+  geDoubleScalarmultPostcompVartimeBin(r: ArrayBuffer, P: ArrayBuffer, c: ArrayBuffer, I: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Binary variant of cnFastHash
+   * @param input - Data of any length
+   * @returns 32-byte Keccak-256 hash
+   */
+  cnFastHashBin(input: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Binary variant of encodeVarint
+   * @returns Encoded varint bytes (1-10 bytes)
+   */
+  encodeVarintBin(value: number): ArrayBuffer;
+
+  /**
+   * Packed variant of generateRingSignature
+   *
+   * Ring members and signatures travel as single buffers instead of one hex
+   * string per member, so a ring costs one allocation each way.
+   *
+   * @param prefixHash - 32-byte transaction prefix hash
+   * @param keyImage - 32-byte key image of the real input
+   * @param publicKeys - n*32 bytes: ring member public keys, back to back (1 <= n <= 1024)
+   * @param secretKey - 32-byte secret key of the real input, or its SecretKeyHandle
+   * @param secretIndex - Index of the real input in the ring (0 to n - 1)
+   * @returns n*64 bytes: one 64-byte signature per ring member, in ring order
+   * @throws Error if the ring is empty or has more than 1024 members
+   */
+  generateRingSignatureBin(
+    prefixHash: ArrayBuffer,
+    keyImage: ArrayBuffer,
+    publicKeys: ArrayBuffer,
+    secretKey: ArrayBuffer | SecretKeyHandle,
+    secretIndex: number
+  ): ArrayBuffer;
+
+  /**
+   * Encode a Cryptonote Base58 address
+   *
+   * Layout: varint(prefix) || spendPublicKey || viewPublicKey || checksum,
+   * where checksum is the first 4 bytes of cnFastHash over the preceding bytes,
+   * Base58-encoded in 8-byte blocks of 11 characters.
+   *
+   * @param prefix - Network prefix (0x7ad4 for Conceal mainnet)
+   * @param spendPublicKeyHex - 64-char hex public spend key
+   * @param viewPublicKeyHex - 64-char hex public view key
+   * @returns Base58 address string
+   */
+  encodeAddress(prefix: number, spendPublicKeyHex: string, viewPublicKeyHex: string): string;
+
+  /**
+   * Decode a Cryptonote Base58 address
+   * @param address - Base58 address string
+   * @returns Prefix and public keys
+   * @throws Error on bad encoding, checksum mismatch or keys that are not curve points
+   */
+  decodeAddress(address: string): DecodedAddress;
+
+  /**
+   * Validate many addresses in one call
+   * @param addresses - Base58 address strings
+   * @param prefix - Expected network prefix
+   * @returns Uint8Array(n): 1 = valid address with the expected prefix, 0 = invalid
+   */
+  validateAddresses(addresses: string[], prefix: number): ArrayBuffer;
+
+  /**
+   * Parse a binary transaction (or bare prefix) in one native pass
+   *
+   * Nothing is copied out of the blob except the tx public key; inputs, outputs,
+   * extra and signatures are described by offsets/lengths into `blob`, so JS can
+   * view them with `new Uint8Array(blob, offset, length)`.
+   *
+   * @param blob - Serialized transaction
+   * @returns Decoded layout
+   * @throws Error on truncated, malformed or trailing data
+   */
+  parseTransaction(blob: ArrayBuffer): ParsedTransaction;
+
+  /**
+   * Serialize a transaction prefix and compute its prefix hash in one call
+   *
+   * The hash can be passed straight to generateRingSignatureBin.
+   *
+   * @param prefix - Structured prefix
+   * @returns Serialized blob and its 32-byte Keccak-256 hash
+   * @throws Error on missing or ill-sized fields, or non-integer / unsafe numbers
+   */
+  serializeTransactionPrefix(prefix: TransactionPrefix): SerializedTransactionPrefix;
+
+  /**
+   * Encode many integers as back-to-back varints in one call
+   * @param values - Float64Array buffer, or BigUint64Array buffer when `bigint` is true
+   * @param bigint - Interpret `values` as unsigned 64-bit integers (default false)
+   * @returns Packed varints and a status byte per element
+   */
+  encodeVarints(values: ArrayBuffer, bigint?: boolean): VarintBatchResult;
+
+  /**
+   * Decode back-to-back varints
+   * A bad element is reported in `status` and decoding resumes at the next element.
+   * @param data - Packed varints
+   * @returns BigUint64Array values and a status byte per element
+   */
+  decodeVarints(data: ArrayBuffer): VarintBatchResult;
+
+  /**
+   * Convert absolute global output indexes to relative offsets for every ring at once
+   *
+   * Each ring is sorted ascending; the first offset stays absolute and every
+   * following one is the delta to its predecessor.
+   *
+   * @param absolute - Float64Array of global output indexes, rings back to back
+   * @param ringSizes - Uint32Array with the size of each ring
+   * @returns Relative offsets plus their varint-packed wire form
+   * @throws Error if ring sizes do not add up, an index is not a non-negative safe integer,
+   *   or a ring contains the same index twice
+   */
+  absoluteToRelativeOffsets(absolute: ArrayBuffer, ringSizes: ArrayBuffer): RingOffsetsResult;
+
+  /**
+   * Convert relative offsets back to absolute global output indexes (prefix sum per ring)
+   * @param relative - Float64Array of relative offsets, rings back to back
+   * @param ringSizes - Uint32Array with the size of each ring
+   * @returns Float64Array of absolute indexes
+   */
+  relativeToAbsoluteOffsets(relative: ArrayBuffer, ringSizes: ArrayBuffer): ArrayBuffer;
+
+  /**
+   * Generate uniformly random curve scalars in one call
+   *
+   * Same construction as `random_scalar`: 64 random bytes reduced mod l per scalar,
+   * drawn from one buffer and reduced in a single native loop.
+   *
+   * @param count - Number of scalars (1 to 65536)
+   * @returns ArrayBuffer of count*32 bytes, scalars back to back
+   * @throws Error if count is not an integer in range
+   */
+  randomScalars(count: number): ArrayBuffer;
+
+  /**
+   * Promise variant of generateRingSignature, run on the native thread pool
+   */
+  generateRingSignatureAsync(
+    prefixHashHex: string,
+    keyImageHex: string,
+    publicKeysHex: string[],
+    secretKeyHex: string | SecretKeyHandle,
+    secretIndex: number
+  ): Promise<string[]>;
+
+  /**
+   * Promise variant of generateRingSignatureBin, run on the native thread pool
+   * Input buffers are copied before the call returns.
+   */
+  generateRingSignatureBinAsync(
+    prefixHash: ArrayBuffer,
+    keyImage: ArrayBuffer,
+    publicKeys: ArrayBuffer,
+    secretKey: ArrayBuffer | SecretKeyHandle,
+    secretIndex: number
+  ): Promise<ArrayBuffer>;
+
+  /**
+   * Promise variant of validateAddresses, run on the native thread pool
+   */
+  validateAddressesAsync(addresses: string[], prefix: number): Promise<ArrayBuffer>;
+
+  /**
+   * Move a secret key into a native handle
+   * Wipe the source buffer afterwards to leave no copy in the JS heap.
+   * @param secretKey - 32-byte secret key
+   * @throws Error if the key is not a reduced scalar
+   */
+  importSecretKey(secretKey: ArrayBuffer): SecretKeyHandle;
+
+  /**
+   * Hex variant of importSecretKey
+   * @param secretKeyHex - 64-char hex string (32 bytes)
+   */
+  importSecretKeyHex(secretKeyHex: string): SecretKeyHandle;
+
+  /**
+   * Generate a random secret key directly in native memory
+   */
+  generateSecretKey(): SecretKeyHandle;
 }
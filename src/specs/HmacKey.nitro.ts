@@ -0,0 +1,16 @@
+import type { HybridObject } from 'react-native-nitro-modules';
+
+/**
+ * Precomputed HMAC-SHA1 key, created by `ConcealCrypto.createHmacKey(key)`.
+ *
+ * Holds the SHA-1 midstates after absorbing key^ipad and key^opad, so repeated MACs
+ * with the same key (TOTP, transaction signing) skip re-hashing both padded key blocks.
+ */
+export interface HmacKey extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
+  /**
+   * Compute HMAC-SHA1 of data with this key
+   * @param data - Message data
+   * @returns 20-byte MAC, identical to `ConcealCrypto.hmacSha1(key, data)`
+   */
+  sign(data: ArrayBuffer): ArrayBuffer;
+}
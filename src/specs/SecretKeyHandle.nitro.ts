@@ -0,0 +1,22 @@
+import type { HybridObject } from 'react-native-nitro-modules';
+
+/**
+ * Cryptonote secret key held in native memory, created by
+ * `Cryptonote.importSecretKey(key)`, `importSecretKeyHex(hex)` or `generateSecretKey()`.
+ *
+ * The key lives in libsodium guarded memory and is wiped on `wipe()` or when the
+ * handle is garbage collected. Every Cryptonote method that takes a secret key also
+ * accepts a handle, so the key never has to exist as a JS string or buffer.
+ */
+export interface SecretKeyHandle extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
+  /**
+   * Public key of this secret key (sec*G)
+   * @returns 32-byte public key
+   */
+  getPublicKey(): ArrayBuffer;
+
+  /**
+   * Zero the key now; any later use of this handle throws
+   */
+  wipe(): void;
+}
@@ -0,0 +1,55 @@
+import type { HybridObject } from 'react-native-nitro-modules';
+
+/**
+ * Encrypting side of a libsodium secretstream (XChaCha20-Poly1305).
+ * Created by `ConcealCrypto.secretstreamInitPush(key)`.
+ *
+ * Large data (backups, exported histories) is sealed chunk by chunk with constant memory.
+ * Chunk order is authenticated: chunks must be pulled in the order they were pushed.
+ */
+export interface SecretStreamPush extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
+  /**
+   * 24-byte stream header, must be sent/stored before the first chunk
+   */
+  readonly header: ArrayBuffer;
+
+  /**
+   * Encrypt one chunk
+   * @param message - Plaintext chunk
+   * @param tag - 0 = message, 1 = push, 2 = rekey, 3 = final (last chunk)
+   * @returns Ciphertext chunk (message length + 17 bytes)
+   * @throws if a final chunk was already pushed
+   */
+  push(message: ArrayBuffer, tag: number): ArrayBuffer;
+
+  /**
+   * Explicitly rekey the stream (must be mirrored on the pulling side)
+   * @throws if a final chunk was already pushed
+   */
+  rekey(): void;
+}
+
+/**
+ * Decrypting side of a libsodium secretstream (XChaCha20-Poly1305).
+ * Created by `ConcealCrypto.secretstreamInitPull(header, key)`.
+ */
+export interface SecretStreamPull extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
+  /**
+   * Tag of the last successfully pulled chunk (3 = final)
+   */
+  readonly tag: number;
+
+  /**
+   * Decrypt and authenticate one chunk
+   * @param ciphertext - Ciphertext chunk as produced by `push`
+   * @returns Plaintext chunk, or null if authentication fails
+   * @throws if a final chunk was already pulled (data appended after the end of the stream)
+   */
+  pull(ciphertext: ArrayBuffer): ArrayBuffer | null;
+
+  /**
+   * Explicitly rekey the stream (mirrors `SecretStreamPush.rekey`)
+   * @throws if a final chunk was already pulled
+   */
+  rekey(): void;
+}
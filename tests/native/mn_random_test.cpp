@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+
+#include "mn_random.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// The generator reseeds once MN_RANDOM_RESEED_INTERVAL bytes have been served
+static void testReseedInterval() {
+    uint8_t buf[4096];
+    mn_random_fill(buf, sizeof(buf));
+    uint64_t start = mn_random_reseed_count();
+    assert(start >= 1);
+
+    // Top up to exactly the interval: no reseed yet
+    for (size_t served = sizeof(buf); served < MN_RANDOM_RESEED_INTERVAL; served += sizeof(buf)) {
+        mn_random_fill(buf, sizeof(buf));
+    }
+    assert(mn_random_reseed_count() == start);
+
+    // The next request crosses the interval
+    mn_random_fill(buf, 1);
+    assert(mn_random_reseed_count() == start + 1);
+}
+
+// A fork()ed child must not replay the parent's buffered keystream
+static void testForkReseeds() {
+    uint8_t buf[32];
+    mn_random_fill(buf, sizeof(buf));  // seed and buffer in the parent
+    uint64_t before = mn_random_reseed_count();
+
+    int fds[2];
+    assert(pipe(fds) == 0);
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        uint8_t child[32];
+        mn_random_fill(child, sizeof(child));
+        bool reseeded = mn_random_reseed_count() == before + 1;
+        ssize_t n = write(fds[1], child, sizeof(child));
+        _exit(reseeded && n == static_cast<ssize_t>(sizeof(child)) ? 0 : 1);
+    }
+    close(fds[1]);
+
+    uint8_t parent[32];
+    mn_random_fill(parent, sizeof(parent));
+    assert(mn_random_reseed_count() == before);
+
+    uint8_t child[32];
+    size_t got = 0;
+    while (got < sizeof(child)) {
+        ssize_t n = read(fds[0], child + got, sizeof(child) - got);
+        assert(n > 0);
+        got += static_cast<size_t>(n);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    assert(waitpid(pid, &status, 0) == pid);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    assert(std::memcmp(parent, child, sizeof(parent)) != 0);
+}
+
+int main() {
+    testReseedInterval();
+    testForkReseeds();
+    std::puts("mn_random: OK");
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+
+#include "Base58.hpp"
+#include "Mnemonic.hpp"
+#include "MnemonicWordlists.hpp"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <sodium.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "crypto-ops.h"
+#include "hash-ops.h"
+}
+
+using namespace margelo::nitro::concealcrypto;
+
+// Published seed / address pairs from the Monero docs and functional tests.
+// Each word's index depends on every word sorted before it, so matching the
+// addresses pins the wordlist order independently of the table itself.
+struct SeedVector {
+  const char* seed;
+  const char* address;
+};
+
+static const SeedVector VECTORS[] = {
+  {"sequence atlas unveil summon pebbles tuesday beer rudely snake rockets different fuselage "
+   "woven tagged bested dented vegan hover rapid fawns obvious muppet randomly seasons randomly",
+   "9wviCeWe2D8XS82k2ovp5EUYLzBt9pYNW2LXUFsZiv8S3Mt21FZ5qQaAroko1enzw3eGr9qC7X1D7Geoo2RrAotYPwq9Gm8"},
+  {"velvet lymph giddy number token physics poetry unquoted nibs useful sabotage limits benches "
+   "lifestyle eden nitrogen anvil fewest avoid batch vials washing fences goat unquoted",
+   "42ey1afDFnn4886T7196doS9GPMzexD9gXpsZJDwVjeRVdFCSoHnv7KPbBeGpzJBzHRCAs9UxqeoyFQMYbqSWYTfJJQAWDm"},
+};
+
+// SHA-256 of the English table, one word per line ("abbey\n...zodiac\n").
+// Compare with upstream monero src/mnemonics/english.h:
+//   grep -o '"[a-z]*"' english.h | tr -d '"' | sha256sum
+// Any edited, misspelled or reordered entry changes it.
+static const char* ENGLISH_SHA256 = "44d2d15559566d3ca2e4836c8ac32174efe1414732fde55b139450f23dedadaf";
+
+static void publicKey(const uint8_t secret[32], uint8_t out[32]) {
+  ge_p3 point;
+  ge_scalarmult_base(&point, secret);
+  ge_p3_tobytes(out, &point);
+}
+
+static void testWordlist() {
+  const auto& words = wordlists::ENGLISH;
+  assert(words.size() == Mnemonic::WORDLIST_SIZE);
+  std::set<std::string_view> prefixes;
+  for (size_t i = 0; i < words.size(); i++) {
+    assert(words[i].size() >= Mnemonic::PREFIX_LENGTH);
+    assert(i == 0 || words[i - 1] < words[i]);
+    prefixes.insert(words[i].substr(0, Mnemonic::PREFIX_LENGTH));
+  }
+  assert(prefixes.size() == words.size());
+
+  std::string joined;
+  for (std::string_view word : words) {
+    joined.append(word);
+    joined.push_back('\n');
+  }
+  uint8_t digest[crypto_hash_sha256_BYTES];
+  crypto_hash_sha256(digest, reinterpret_cast<const uint8_t*>(joined.data()), joined.size());
+  char hex[2 * crypto_hash_sha256_BYTES + 1];
+  for (size_t i = 0; i < sizeof(digest); i++) std::snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+  assert(std::strcmp(hex, ENGLISH_SHA256) == 0);
+}
+
+// Seed -> spend/view public keys must match the published address, and the
+// entropy must encode back to the same 25 words
+static void testSeedVectors() {
+  for (const SeedVector& v : VECTORS) {
+    std::vector<uint8_t> entropy = Mnemonic::decode(v.seed);
+    assert(entropy.size() == 32);
+    assert(Mnemonic::encode(entropy.data(), entropy.size(), "english") == v.seed);
+
+    std::vector<uint8_t> address;
+    assert(Base58::decode(v.address, address));
+    assert(address.size() == 69);
+
+    uint8_t spend[32];
+    std::memcpy(spend, entropy.data(), 32);
+    sc_reduce32(spend);
+    uint8_t view[32];
+    cn_fast_hash(spend, sizeof(spend), reinterpret_cast<char*>(view));
+    sc_reduce32(view);
+
+    uint8_t spendPublic[32];
+    uint8_t viewPublic[32];
+    publicKey(spend, spendPublic);
+    publicKey(view, viewPublic);
+    assert(std::memcmp(spendPublic, address.data() + 1, 32) == 0);
+    assert(std::memcmp(viewPublic, address.data() + 33, 32) == 0);
+  }
+}
+
+// Abbreviated words decode by prefix; a wrong checksum word is rejected
+static void testPrefixAndChecksum() {
+  const std::string seed = VECTORS[0].seed;
+  std::string abbreviated;
+  size_t start = 0;
+  while (start < seed.size()) {
+    size_t end = seed.find(' ', start);
+    if (end == std::string::npos) end = seed.size();
+    if (!abbreviated.empty()) abbreviated += ' ';
+    abbreviated += seed.substr(start, Mnemonic::PREFIX_LENGTH);
+    start = end + 1;
+  }
+  assert(Mnemonic::decode(abbreviated) == Mnemonic::decode(seed));
+
+  std::string badChecksum = seed.substr(0, seed.rfind(' ')) + " atlas";
+  bool threw = false;
+  try {
+    Mnemonic::decode(badChecksum);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+}
+
+int main() {
+  testWordlist();
+  testSeedVectors();
+  testPrefixAndChecksum();
+  std::puts("mnemonic: OK");
+  return 0;
+}
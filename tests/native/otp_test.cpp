@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+
+#include "Otp.hpp"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace margelo::nitro::concealcrypto;
+
+static void initKey(Otp::Key& key, Otp::Algorithm algorithm, const char* secret) {
+  Otp::initKey(key, algorithm, reinterpret_cast<const uint8_t*>(secret), std::strlen(secret));
+}
+
+// RFC 4226 appendix D
+static void testHotpVectors() {
+  static const char* codes[] = {"755224", "287082", "359152", "969429", "338314",
+                                "254676", "287922", "162583", "399871", "520489"};
+  Otp::Key key;
+  initKey(key, Otp::Algorithm::SHA1, "12345678901234567890");
+  for (uint64_t counter = 0; counter < 10; counter++) {
+    assert(Otp::format(Otp::hotp(key, counter, 6), 6) == codes[counter]);
+  }
+}
+
+// RFC 6238 appendix B (8 digits, 30 s step)
+static void testTotpVectors() {
+  struct Vector {
+    double time;
+    const char* sha1;
+    const char* sha256;
+    const char* sha512;
+  };
+  static const Vector vectors[] = {
+    {59, "94287082", "46119246", "90693936"},
+    {1111111109, "07081804", "68084774", "25091201"},
+    {1111111111, "14050471", "67062674", "99943326"},
+    {1234567890, "89005924", "91819424", "93441116"},
+    {2000000000, "69279037", "90698825", "38618901"},
+    {20000000000, "65353130", "77737706", "47863826"},
+  };
+
+  Otp::Key sha1, sha256, sha512;
+  initKey(sha1, Otp::Algorithm::SHA1, "12345678901234567890");
+  initKey(sha256, Otp::Algorithm::SHA256, "12345678901234567890123456789012");
+  initKey(sha512, Otp::Algorithm::SHA512,
+          "1234567890123456789012345678901234567890123456789012345678901234");
+
+  for (const Vector& v : vectors) {
+    uint64_t counter = Otp::timeCounter(v.time, 30);
+    assert(Otp::format(Otp::hotp(sha1, counter, 8), 8) == v.sha1);
+    assert(Otp::format(Otp::hotp(sha256, counter, 8), 8) == v.sha256);
+    assert(Otp::format(Otp::hotp(sha512, counter, 8), 8) == v.sha512);
+
+    assert(Otp::verify(sha1, v.sha1, counter, 0, 8));
+    assert(Otp::verify(sha256, v.sha256, counter, 0, 8));
+    assert(Otp::verify(sha512, v.sha512, counter, 0, 8));
+  }
+
+  // One step either side is accepted within window 1, not within window 0
+  uint64_t counter = Otp::timeCounter(59, 30);
+  assert(Otp::verify(sha1, "94287082", counter + 1, 1, 8));
+  assert(!Otp::verify(sha1, "94287082", counter + 1, 0, 8));
+}
+
+// The expected length comes from digits, never from the submitted code
+static void testRejectsWrongLength() {
+  Otp::Key key;
+  initKey(key, Otp::Algorithm::SHA1, "12345678901234567890");
+  uint64_t counter = Otp::timeCounter(59, 30);
+
+  // No single character may pass as a 1-digit truncation
+  for (char c = '0'; c <= '9'; c++) {
+    assert(!Otp::verify(key, std::string(1, c), counter, 1, 6));
+  }
+  assert(!Otp::verify(key, "", counter, 1, 6));
+  assert(!Otp::verify(key, "94287082", counter, 1, 6));   // right code, wrong digits
+  assert(!Otp::verify(key, "4287082", counter, 1, 6));
+  assert(!Otp::verify(key, "12345678901", counter, 1, 6));
+  assert(!Otp::verify(key, "28708a", counter, 1, 6));
+  assert(Otp::verify(key, "287082", counter, 1, 6));
+}
+
+int main() {
+  testHotpVectors();
+  testTotpVectors();
+  testRejectsWrongLength();
+  std::puts("otp: OK");
+  return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+
+/**
+ * 1 MB result-buffer benchmark for the ArrayBuffer-returning methods
+ * Nitro isn't available on the host, so ArrayBuffer is modelled by what it
+ * does underneath: ArrayBuffer::allocate(n) is a new uint8_t[n] and
+ * ArrayBuffer::copy(vector) is a new uint8_t[n] plus a memcpy.
+ *   copy:   std::vector scratch -> compute -> ArrayBuffer::copy (old path)
+ *   direct: ArrayBuffer::allocate -> compute into it (current path)
+ */
+
+#include "HexCodec.hpp"
+#include "ParallelChacha.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::concealcrypto;
+
+static constexpr size_t SIZE = 1024 * 1024;
+static constexpr int ITERATIONS = 200;
+
+static volatile uint8_t g_sink;
+
+static std::unique_ptr<uint8_t[]> copyToBuffer(const std::vector<uint8_t>& v) {
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[v.size()]);
+  std::memcpy(buffer.get(), v.data(), v.size());
+  return buffer;
+}
+
+// Median per-call time in microseconds
+template <typename Fn>
+static double measure(Fn&& fn) {
+  std::vector<double> samples;
+  for (int i = 0; i < ITERATIONS; i++) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<uint8_t[]> result = fn();
+    auto end = std::chrono::steady_clock::now();
+    g_sink = result[SIZE - 1];
+    samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+static void report(const char* name, double copy, double direct) {
+  std::printf("%-10s copy %8.1f us   direct %8.1f us   saved %5.1f%%\n",
+              name, copy, direct, 100.0 * (copy - direct) / copy);
+}
+
+int main() {
+  std::vector<uint8_t> input(SIZE);
+  for (size_t i = 0; i < SIZE; i++) input[i] = static_cast<uint8_t>(i * 131 + 7);
+  const uint8_t key[32] = {1, 2, 3};
+  const uint8_t iv[8] = {4, 5, 6};
+  const std::string hex = HexCodec::encode(input.data(), input.size());
+
+  auto chachaCopy = [&] {
+    std::vector<uint8_t> output(SIZE);
+    ParallelChacha::xorStream(input.data(), SIZE, key, iv, output.data(), 8);
+    return copyToBuffer(output);
+  };
+  auto chachaDirect = [&] {
+    std::unique_ptr<uint8_t[]> output(new uint8_t[SIZE]);
+    ParallelChacha::xorStream(input.data(), SIZE, key, iv, output.get(), 8);
+    return output;
+  };
+  auto hexCopy = [&] {
+    std::vector<uint8_t> output(SIZE);
+    HexCodec::decode(hex.data(), hex.size(), output.data());
+    return copyToBuffer(output);
+  };
+  auto hexDirect = [&] {
+    std::unique_ptr<uint8_t[]> output(new uint8_t[SIZE]);
+    HexCodec::decode(hex.data(), hex.size(), output.get());
+    return output;
+  };
+
+  std::printf("1 MB results, median of %d runs\n", ITERATIONS);
+  report("chacha8", measure(chachaCopy), measure(chachaDirect));
+  report("hextobin", measure(hexCopy), measure(hexDirect));
+  return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Acktarius, Conceal Devs
+ *
+ * This file is part of react-native-conceal-crypto.
+ *
+ * Distributed under the MIT software license, see the accompanying
+ * file LICENSE or http://www.opensource.org/licenses/mit-license.php.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Host-only stand-in for Nitro's ArrayBuffer, enough to compile the
+// ArrayBuffer overloads of helpers such as Hmac without React Native
+namespace margelo::nitro {
+
+class ArrayBuffer {
+public:
+  static std::shared_ptr<ArrayBuffer> allocate(size_t size) {
+    auto buffer = std::make_shared<ArrayBuffer>();
+    buffer->_data.resize(size);
+    return buffer;
+  }
+
+  static std::shared_ptr<ArrayBuffer> copy(const std::vector<uint8_t>& data) {
+    auto buffer = std::make_shared<ArrayBuffer>();
+    buffer->_data = data;
+    return buffer;
+  }
+
+  uint8_t* data() { return _data.data(); }
+  size_t size() const { return _data.size(); }
+
+private:
+  std::vector<uint8_t> _data;
+};
+
+} // namespace margelo::nitro
+
+namespace margelo::nitro::concealcrypto {
+using margelo::nitro::ArrayBuffer;
+} // namespace margelo::nitro::concealcrypto